@@ -0,0 +1,574 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/binary_reader.h"
+#include "sjson/error.h"
+#include "sjson/number_token.h"
+#include "sjson/parser.h"
+#include "sjson/string_view.h"
+#include "sjson/version.h"
+#include "sjson/writer.h"
+#include "sjson/impl/binary_format.impl.h"
+#include "sjson/impl/string_escape.impl.h"
+
+#include <cstring>
+#include <cstdint>
+#include <limits>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Walks the remaining SJSON input of a parser and emits binary nodes and strings.
+		// When the output pointers are nullptr, only the sizes are computed.
+		//////////////////////////////////////////////////////////////////////////
+		class BinaryCompiler
+		{
+		public:
+			// Deepest nesting of objects and arrays that can be compiled, matches EventParser
+			static constexpr uint32_t k_max_depth = 64;
+
+			BinaryCompiler(Parser& parser, uint8_t* string_table, uint8_t* nodes)
+				: m_parser(parser)
+				, m_string_table(string_table)
+				, m_nodes(nodes)
+				, m_string_table_size(0)
+				, m_nodes_size(0)
+				, m_depth(0)
+			{}
+
+			BinaryCompiler(const BinaryCompiler&) = delete;
+			BinaryCompiler& operator=(const BinaryCompiler&) = delete;
+
+			bool compile()
+			{
+				while (true)
+				{
+					if (!m_parser.skip_comments_and_whitespace())
+						return false;
+
+					if (m_parser.eof())
+						return true;
+
+					if (!compile_member())
+						return false;
+				}
+			}
+
+			size_t get_string_table_size() const { return m_string_table_size; }
+			size_t get_nodes_size() const { return m_nodes_size; }
+
+		private:
+			Parser& m_parser;
+			uint8_t* m_string_table;
+			uint8_t* m_nodes;
+			size_t m_string_table_size;
+			size_t m_nodes_size;
+			uint32_t m_depth;
+
+			bool compile_member()
+			{
+				if (!m_parser.skip_comments_and_whitespace_fail_if_eof())
+					return false;
+
+				StringView key;
+				const bool is_quoted = m_parser.m_state.symbol == '"';
+				if (is_quoted ? !m_parser.read_string(key) : !m_parser.read_unquoted_key(key))
+					return false;
+
+				if (!m_parser.read_equal_sign())
+					return false;
+
+				write_string_node(BinaryNodeType::Key, key, is_quoted);
+				return compile_value();
+			}
+
+			bool compile_value()
+			{
+				if (!m_parser.skip_comments_and_whitespace_fail_if_eof())
+					return false;
+
+				switch (m_parser.m_state.symbol)
+				{
+				case '{':
+					return m_parser.read_opening_brace() && compile_object();
+				case '[':
+					return m_parser.read_opening_bracket() && compile_array();
+				case '"':
+				{
+					StringView value;
+					if (!m_parser.read_string(value))
+						return false;
+
+					write_string_node(BinaryNodeType::String, value, true);
+					return true;
+				}
+				case 'n':
+				case 't':
+				case 'f':
+				{
+					if (m_parser.try_read_null())
+					{
+						write_node(BinaryNodeType::Null);
+						return true;
+					}
+
+					bool value;
+					if (!m_parser.read_bool(value))
+						return false;
+
+					write_node(value ? BinaryNodeType::True : BinaryNodeType::False);
+					return true;
+				}
+				default:
+					return compile_number();
+				}
+			}
+
+			// This function assumes that the opening brace has already been consumed
+			bool compile_object()
+			{
+				if (!enter_container())
+					return false;
+
+				write_node(BinaryNodeType::ObjectBegins);
+
+				while (!m_parser.try_object_ends())
+				{
+					if (!compile_member())
+						return false;
+				}
+
+				write_node(BinaryNodeType::ObjectEnds);
+				m_depth--;
+				return true;
+			}
+
+			// This function assumes that the opening bracket has already been consumed
+			bool compile_array()
+			{
+				if (!enter_container())
+					return false;
+
+				write_node(BinaryNodeType::ArrayBegins);
+
+				if (!m_parser.try_array_ends())
+				{
+					while (true)
+					{
+						if (!compile_value())
+							return false;
+
+						if (m_parser.try_array_ends())
+							break;
+
+						if (!m_parser.read_comma())
+							return false;
+					}
+				}
+
+				write_node(BinaryNodeType::ArrayEnds);
+				m_depth--;
+				return true;
+			}
+
+			// Objects and arrays are compiled recursively, the depth is bounded to protect the stack from untrusted input
+			bool enter_container()
+			{
+				if (m_depth == k_max_depth)
+				{
+					m_parser.set_error(ParserError::NestingTooDeep);
+					return false;
+				}
+
+				m_depth++;
+				return true;
+			}
+
+			// The number token is scanned once and classified from its characters.
+			// It is stored as an integer when it has no fraction or exponent and fits in 64 bits,
+			// e.g.: 12 or 0x1F but not 12.5, 1e3, 0x1p4, or -0
+			bool compile_number()
+			{
+				StringView token;
+				if (!m_parser.read_number_token(token))
+					return false;
+
+				if (is_integer_token(token))
+				{
+					if (token.c_str()[0] == '-')
+					{
+						int64_t int_value;
+						if (to_int(token, int_value) && int_value != 0)
+						{
+							write_node(BinaryNodeType::Integer);
+							write_payload(&int_value, sizeof(int_value));
+							return true;
+						}
+					}
+					else
+					{
+						uint64_t uint_value;
+						if (to_int(token, uint_value))
+						{
+							if (uint_value <= uint64_t(std::numeric_limits<int64_t>::max()))
+							{
+								const int64_t int_value = static_cast<int64_t>(uint_value);
+								write_node(BinaryNodeType::Integer);
+								write_payload(&int_value, sizeof(int_value));
+							}
+							else
+							{
+								write_node(BinaryNodeType::UnsignedInteger);
+								write_payload(&uint_value, sizeof(uint_value));
+							}
+
+							return true;
+						}
+					}
+				}
+
+				double dbl_value;
+				if (!to_double(token, dbl_value))
+				{
+					m_parser.set_error(token.size() >= k_max_number_token_length ? ParserError::NumberIsTooLong : ParserError::InvalidNumber);
+					return false;
+				}
+
+				write_node(BinaryNodeType::Double);
+				write_payload(&dbl_value, sizeof(dbl_value));
+				return true;
+			}
+
+			// Hexadecimal digits include 'e' so only a 'p' marks a hexadecimal exponent
+			static bool is_integer_token(const StringView& token)
+			{
+				const bool is_hex = is_hex_number_token(token);
+				for (size_t i = 0; i < token.size(); ++i)
+				{
+					const char symbol = token.c_str()[i];
+					if (symbol == '.')
+						return false;
+
+					if (is_hex ? (symbol == 'p' || symbol == 'P') : (symbol == 'e' || symbol == 'E'))
+						return false;
+				}
+
+				return true;
+			}
+
+			void write_node(BinaryNodeType type)
+			{
+				if (m_nodes != nullptr)
+					m_nodes[m_nodes_size] = static_cast<uint8_t>(type);
+
+				m_nodes_size++;
+			}
+
+			void write_payload(const void* payload, size_t payload_size)
+			{
+				if (m_nodes != nullptr)
+					std::memcpy(m_nodes + m_nodes_size, payload, payload_size);
+
+				m_nodes_size += payload_size;
+			}
+
+			// Quoted keys and strings are unescaped, unquoted keys cannot contain escape sequences
+			void write_string_node(BinaryNodeType type, const StringView& value, bool is_escaped)
+			{
+				SJSON_CPP_ASSERT(m_string_table_size <= std::numeric_limits<uint32_t>::max(), "Binary SJSON string table cannot exceed 4 GB");
+
+				const uint32_t string_offset = static_cast<uint32_t>(m_string_table_size);
+				write_node(type);
+				write_payload(&string_offset, sizeof(string_offset));
+
+				char* output = m_string_table != nullptr ? reinterpret_cast<char*>(m_string_table + m_string_table_size + sizeof(uint32_t)) : nullptr;
+
+				uint32_t length;
+				if (is_escaped)
+				{
+					length = static_cast<uint32_t>(unescape_string(value.c_str(), value.size(), output));
+				}
+				else
+				{
+					length = static_cast<uint32_t>(value.size());
+					if (output != nullptr)
+						std::memcpy(output, value.c_str(), length);
+				}
+
+				if (output != nullptr)
+				{
+					std::memcpy(m_string_table + m_string_table_size, &length, sizeof(length));
+					output[length] = '\0';
+				}
+
+				m_string_table_size += sizeof(length) + length + 1;
+			}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reads every node of a binary document and writes it back as SJSON text.
+		//////////////////////////////////////////////////////////////////////////
+		class BinaryDecompiler
+		{
+		public:
+			explicit BinaryDecompiler(BinaryReader& reader)
+				: m_reader(reader)
+			{}
+
+			BinaryDecompiler(const BinaryDecompiler&) = delete;
+			BinaryDecompiler& operator=(const BinaryDecompiler&) = delete;
+
+			bool decompile(ObjectWriter& writer) { return decompile_members(writer, true); }
+
+		private:
+			BinaryReader& m_reader;
+
+			bool decompile_members(ObjectWriter& writer, bool is_root)
+			{
+				while (is_root ? !m_reader.eof() : !m_reader.try_object_ends())
+				{
+					StringView key;
+					BinaryNodeType type;
+					if (!m_reader.read_key(key) || !m_reader.peek_node_type(type))
+						return false;
+
+					bool is_valid = true;
+					switch (type)
+					{
+					case BinaryNodeType::Null:
+						m_reader.try_read_null();
+						writer.insert_null(key);
+						break;
+					case BinaryNodeType::False:
+					case BinaryNodeType::True:
+					{
+						bool value;
+						if (!m_reader.read_value(value))
+							return false;
+
+						writer.insert(key, value);
+						break;
+					}
+					case BinaryNodeType::Integer:
+					{
+						int64_t value;
+						if (!m_reader.read_value(value))
+							return false;
+
+						writer.insert(key, value);
+						break;
+					}
+					case BinaryNodeType::UnsignedInteger:
+					{
+						uint64_t value;
+						if (!m_reader.read_value(value))
+							return false;
+
+						writer.insert(key, value);
+						break;
+					}
+					case BinaryNodeType::Double:
+					{
+						double value;
+						if (!m_reader.read_value(value))
+							return false;
+
+						writer.insert(key, value);
+						break;
+					}
+					case BinaryNodeType::String:
+					{
+						StringView value;
+						if (!m_reader.read_value(value))
+							return false;
+
+						writer.insert(key, value);
+						break;
+					}
+					case BinaryNodeType::ObjectBegins:
+						m_reader.object_begins();
+						writer.insert(key, [&](ObjectWriter& object_writer) { is_valid = decompile_members(object_writer, false); });
+						break;
+					case BinaryNodeType::ArrayBegins:
+						m_reader.array_begins();
+						writer.insert(key, [&](ArrayWriter& array_writer) { is_valid = decompile_elements(array_writer); });
+						break;
+					default:
+						m_reader.set_error(ParserError::InvalidBinaryDocument);
+						return false;
+					}
+
+					if (!is_valid)
+						return false;
+				}
+
+				return m_reader.is_valid();
+			}
+
+			bool decompile_elements(ArrayWriter& writer)
+			{
+				while (!m_reader.try_array_ends())
+				{
+					BinaryNodeType type;
+					if (!m_reader.peek_node_type(type))
+						return false;
+
+					bool is_valid = true;
+					switch (type)
+					{
+					case BinaryNodeType::Null:
+						m_reader.try_read_null();
+						writer.push_null();
+						break;
+					case BinaryNodeType::False:
+					case BinaryNodeType::True:
+					{
+						bool value;
+						if (!m_reader.read_value(value))
+							return false;
+
+						writer.push(value);
+						break;
+					}
+					case BinaryNodeType::Integer:
+					{
+						int64_t value;
+						if (!m_reader.read_value(value))
+							return false;
+
+						writer.push(value);
+						break;
+					}
+					case BinaryNodeType::UnsignedInteger:
+					{
+						uint64_t value;
+						if (!m_reader.read_value(value))
+							return false;
+
+						writer.push(value);
+						break;
+					}
+					case BinaryNodeType::Double:
+					{
+						double value;
+						if (!m_reader.read_value(value))
+							return false;
+
+						writer.push(value);
+						break;
+					}
+					case BinaryNodeType::String:
+					{
+						StringView value;
+						if (!m_reader.read_value(value))
+							return false;
+
+						writer.push(value);
+						break;
+					}
+					case BinaryNodeType::ObjectBegins:
+						m_reader.object_begins();
+						writer.push([&](ObjectWriter& object_writer) { is_valid = decompile_members(object_writer, false); });
+						break;
+					case BinaryNodeType::ArrayBegins:
+						m_reader.array_begins();
+						writer.push([&](ArrayWriter& array_writer) { is_valid = decompile_elements(array_writer); });
+						break;
+					default:
+						m_reader.set_error(ParserError::InvalidBinaryDocument);
+						return false;
+					}
+
+					if (!is_valid)
+						return false;
+				}
+
+				return m_reader.is_valid();
+			}
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Compiles the remaining SJSON input of a parser into a binary document that
+	// can be read with a BinaryReader without any tokenization.
+	// Returns the size of the binary document or 0 if the input could not be parsed,
+	// the parser then holds the error. The document is only written when the buffer
+	// is large enough to hold it, call with a nullptr buffer to query its size.
+	// The input is parsed twice when the document is written.
+	//
+	// Binary documents are meant for shipping builds, they are only compatible
+	// with platforms that share the same endianness and the same sjson-cpp binary version.
+	//////////////////////////////////////////////////////////////////////////
+	inline size_t compile_binary(Parser& parser, void* buffer, size_t buffer_size)
+	{
+		const ParserState start_of_input = parser.save_state();
+
+		sjson_impl::BinaryCompiler sizing_compiler(parser, nullptr, nullptr);
+		if (!sizing_compiler.compile())
+			return 0;
+
+		const size_t string_table_size = sizing_compiler.get_string_table_size();
+		const size_t nodes_size = sizing_compiler.get_nodes_size();
+		SJSON_CPP_ASSERT(string_table_size <= std::numeric_limits<uint32_t>::max() && nodes_size <= std::numeric_limits<uint32_t>::max(), "Binary SJSON documents cannot exceed 4 GB");
+
+		const size_t document_size = sizeof(sjson_impl::BinaryHeader) + string_table_size + nodes_size;
+		if (buffer == nullptr || buffer_size < document_size)
+			return document_size;
+
+		sjson_impl::BinaryHeader header;
+		header.tag = sjson_impl::k_binary_tag;
+		header.version = sjson_impl::k_binary_version;
+		header.string_table_size = static_cast<uint32_t>(string_table_size);
+		header.nodes_size = static_cast<uint32_t>(nodes_size);
+
+		uint8_t* bytes = static_cast<uint8_t*>(buffer);
+		std::memcpy(bytes, &header, sizeof(header));
+
+		parser.restore_state(start_of_input);
+
+		uint8_t* string_table = bytes + sizeof(header);
+		sjson_impl::BinaryCompiler compiler(parser, string_table, string_table + string_table_size);
+		compiler.compile();
+
+		return document_size;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the remaining nodes of a binary document as SJSON text.
+	// Returns false if the document is corrupted, the reader then holds the error.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool decompile_binary(BinaryReader& reader, ObjectWriter& writer)
+	{
+		sjson_impl::BinaryDecompiler decompiler(reader);
+		return decompiler.decompile(writer);
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
@@ -0,0 +1,773 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/key.h"
+#include "sjson/parser_error.h"
+#include "sjson/string_view.h"
+#include "sjson/version.h"
+#include "sjson/impl/base64.impl.h"
+#include "sjson/impl/binary_format.impl.h"
+#include "sjson/impl/number_conversion.impl.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		class BinaryDecompiler;
+	}
+
+	struct BinaryReaderState
+	{
+		size_t offset = 0;
+
+		ParserError error;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A BinaryReader reads a binary SJSON document produced by compile_binary.
+	// It has the same API and the same semantics as the Parser: keys are read in order
+	// and try_read functions restore the state on failure. Nodes are read directly
+	// from the provided buffer, nothing is tokenized or converted from text.
+	//
+	// Unlike the Parser, strings have been unescaped when the document was compiled.
+	// Errors are reported as ParserError values, the line is always 0 and the
+	// column holds the offset of the node that could not be read.
+	//
+	// The document memory must outlive the reader and every StringView it returns.
+	//////////////////////////////////////////////////////////////////////////
+	class BinaryReader
+	{
+	public:
+		BinaryReader(const void* document, size_t document_size)
+			: m_strings(nullptr)
+			, m_nodes(nullptr)
+			, m_string_table_size(0)
+			, m_nodes_size(0)
+			, m_is_document_valid(false)
+			, m_state()
+		{
+			sjson_impl::BinaryHeader header;
+			if (document != nullptr && document_size >= sizeof(header))
+			{
+				std::memcpy(&header, document, sizeof(header));
+
+				const uint8_t* bytes = static_cast<const uint8_t*>(document);
+				if (header.tag == sjson_impl::k_binary_tag && header.version == sjson_impl::k_binary_version &&
+					size_t(header.string_table_size) + size_t(header.nodes_size) <= document_size - sizeof(header))
+				{
+					m_strings = bytes + sizeof(header);
+					m_nodes = m_strings + header.string_table_size;
+					m_string_table_size = header.string_table_size;
+					m_nodes_size = header.nodes_size;
+					m_is_document_valid = true;
+				}
+			}
+
+			reset_state();
+		}
+
+		~BinaryReader() = default;
+
+		// Prevent copying to avoid potential mistakes
+		BinaryReader(const BinaryReader& other) = delete;
+		BinaryReader& operator=(const BinaryReader& other) = delete;
+
+		// Allow moving
+		BinaryReader(BinaryReader&& other) = default;
+		BinaryReader& operator=(BinaryReader&& other) = default;
+
+		bool object_begins() { return read_node(sjson_impl::BinaryNodeType::ObjectBegins, ParserError::OpeningBraceExpected); }
+		bool object_begins(const Key& having_name) { return read_key(having_name) && object_begins(); }
+		bool object_ends() { return read_node(sjson_impl::BinaryNodeType::ObjectEnds, ParserError::ClosingBraceExpected); }
+
+		bool try_object_begins(const Key& having_name)
+		{
+			BinaryReaderState s = save_state();
+
+			if (!object_begins(having_name))
+			{
+				restore_state(s);
+				return false;
+			}
+
+			return true;
+		}
+
+		bool try_object_ends()
+		{
+			BinaryReaderState s = save_state();
+
+			if (!object_ends())
+			{
+				restore_state(s);
+				return false;
+			}
+
+			return true;
+		}
+
+		bool array_begins() { return read_node(sjson_impl::BinaryNodeType::ArrayBegins, ParserError::OpeningBracketExpected); }
+		bool array_begins(const Key& having_name) { return read_key(having_name) && array_begins(); }
+		bool array_ends() { return read_node(sjson_impl::BinaryNodeType::ArrayEnds, ParserError::ClosingBracketExpected); }
+
+		bool try_array_begins(const Key& having_name)
+		{
+			BinaryReaderState s = save_state();
+
+			if (!array_begins(having_name))
+			{
+				restore_state(s);
+				return false;
+			}
+
+			return true;
+		}
+
+		bool try_array_ends()
+		{
+			BinaryReaderState s = save_state();
+
+			if (!array_ends())
+			{
+				restore_state(s);
+				return false;
+			}
+
+			return true;
+		}
+
+		bool read(const Key& key, StringView& value) { return read_key(key) && read_value(value); }
+		bool read(const Key& key, bool& value) { return read_key(key) && read_value(value); }
+		bool read(const Key& key, double& value) { return read_key(key) && read_value(value); }
+		bool read(const Key& key, float& value) { return read_key(key) && read_value(value); }
+		bool read(const Key& key, int8_t& value) { return read_key(key) && read_value(value); }
+		bool read(const Key& key, uint8_t& value) { return read_key(key) && read_value(value); }
+		bool read(const Key& key, int16_t& value) { return read_key(key) && read_value(value); }
+		bool read(const Key& key, uint16_t& value) { return read_key(key) && read_value(value); }
+		bool read(const Key& key, int32_t& value) { return read_key(key) && read_value(value); }
+		bool read(const Key& key, uint32_t& value) { return read_key(key) && read_value(value); }
+		bool read(const Key& key, int64_t& value) { return read_key(key) && read_value(value); }
+		bool read(const Key& key, uint64_t& value) { return read_key(key) && read_value(value); }
+
+		bool read(const Key& key, double* values, uint32_t num_elements)
+		{
+			return read_key(key) && array_begins() && read(values, num_elements) && array_ends();
+		}
+
+		bool read(const Key& key, StringView* values, uint32_t num_elements)
+		{
+			return read_key(key) && array_begins() && read(values, num_elements) && array_ends();
+		}
+
+		template<typename NumberType>
+		bool read_matrix(const Key& key, NumberType* values, uint32_t inner_size, uint32_t outer_count, size_t stride)
+		{
+			return read_key(key) && read_matrix(values, inner_size, outer_count, stride);
+		}
+
+		template<typename NumberType>
+		bool read_matrix(const Key& key, NumberType* values, uint32_t inner_size, uint32_t outer_count)
+		{
+			return read_matrix(key, values, inner_size, outer_count, inner_size * sizeof(NumberType));
+		}
+
+		bool read_half(const Key& key, uint16_t* values, uint32_t num_elements)
+		{
+			return read_key(key) && array_begins() && read_half(values, num_elements) && array_ends();
+		}
+
+		template<typename IntegerType>
+		bool read_normalized(const Key& key, IntegerType* values, uint32_t num_elements)
+		{
+			return read_key(key) && array_begins() && read_normalized(values, num_elements) && array_ends();
+		}
+
+		// See Parser::read_enum
+		template<typename EnumType, size_t N>
+		bool read_enum(const Key& key, EnumType& value, const EnumEntry<EnumType> (&table)[N])
+		{
+			return read_key(key) && read_enum_value(value, table, N);
+		}
+
+		template<typename EnumType, size_t N>
+		bool read_enum(const Key& key, EnumType* values, uint32_t num_elements, const EnumEntry<EnumType> (&table)[N])
+		{
+			return read_key(key) && array_begins() && read_enum(values, num_elements, table) && array_ends();
+		}
+
+		template<typename EnumType, size_t N>
+		bool try_read_enum(const Key& key, EnumType& value, const EnumEntry<EnumType> (&table)[N], EnumType default_value)
+		{
+			BinaryReaderState s = save_state();
+
+			if (read_key(key))
+			{
+				if (try_read_null())
+				{
+					value = default_value;
+					return false;
+				}
+
+				if (read_enum_value(value, table, N))
+					return true;
+			}
+
+			restore_state(s);
+			value = default_value;
+			return false;
+		}
+
+		template<typename EnumType, size_t N>
+		bool read_enum(EnumType* values, uint32_t num_elements, const EnumEntry<EnumType> (&table)[N])
+		{
+			for (uint32_t i = 0; i < num_elements; ++i)
+			{
+				if (!read_enum_value(values[i], table, N))
+					return false;
+			}
+
+			return true;
+		}
+
+		// See Parser::read_blob
+		bool read_blob(const Key& key, void* data, size_t data_size)
+		{
+			StringView value;
+			if (!read(key, value))
+				return false;
+
+			if (!sjson_impl::decode_base64(value.c_str(), value.size(), static_cast<uint8_t*>(data), data_size))
+			{
+				set_error(ParserError::InvalidBlob);
+				return false;
+			}
+
+			return true;
+		}
+
+		template<typename T, typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr>
+		bool read_blob(const Key& key, T* values, size_t num_elements) { return read_blob(key, static_cast<void*>(values), num_elements * sizeof(T)); }
+
+		bool try_read(const Key& key, StringView& value, const char* default_value) { return try_read_impl(key, value, StringView(default_value)); }
+		bool try_read(const Key& key, bool& value, bool default_value) { return try_read_impl(key, value, default_value); }
+		bool try_read(const Key& key, double& value, double default_value) { return try_read_impl(key, value, default_value); }
+		bool try_read(const Key& key, float& value, float default_value) { return try_read_impl(key, value, default_value); }
+		bool try_read(const Key& key, int8_t& value, int8_t default_value) { return try_read_impl(key, value, default_value); }
+		bool try_read(const Key& key, uint8_t& value, uint8_t default_value) { return try_read_impl(key, value, default_value); }
+		bool try_read(const Key& key, int16_t& value, int16_t default_value) { return try_read_impl(key, value, default_value); }
+		bool try_read(const Key& key, uint16_t& value, uint16_t default_value) { return try_read_impl(key, value, default_value); }
+		bool try_read(const Key& key, int32_t& value, int32_t default_value) { return try_read_impl(key, value, default_value); }
+		bool try_read(const Key& key, uint32_t& value, uint32_t default_value) { return try_read_impl(key, value, default_value); }
+		bool try_read(const Key& key, int64_t& value, int64_t default_value) { return try_read_impl(key, value, default_value); }
+		bool try_read(const Key& key, uint64_t& value, uint64_t default_value) { return try_read_impl(key, value, default_value); }
+
+		bool try_read(const Key& key, double* values, uint32_t num_elements, double default_value)
+		{
+			return try_read_array_impl(key, values, num_elements, default_value);
+		}
+
+		bool try_read(const Key& key, StringView* values, uint32_t num_elements, const char* default_value)
+		{
+			return try_read_array_impl(key, values, num_elements, StringView(default_value));
+		}
+
+		bool read(double* values, uint32_t num_elements)
+		{
+			for (uint32_t i = 0; i < num_elements; ++i)
+			{
+				if (!read_value(values[i]))
+					return false;
+			}
+
+			return true;
+		}
+
+		bool read(StringView* values, uint32_t num_elements)
+		{
+			for (uint32_t i = 0; i < num_elements; ++i)
+			{
+				if (!read_value(values[i]))
+					return false;
+			}
+
+			return true;
+		}
+
+		bool read_half(uint16_t* values, uint32_t num_elements)
+		{
+			float chunk[sjson_impl::k_conversion_chunk_size];
+
+			for (uint32_t chunk_offset = 0; chunk_offset < num_elements; chunk_offset += sjson_impl::k_conversion_chunk_size)
+			{
+				const uint32_t chunk_size = std::min(num_elements - chunk_offset, sjson_impl::k_conversion_chunk_size);
+				if (!read_float_chunk(chunk, chunk_size))
+					return false;
+
+				sjson_impl::convert_to_half(chunk, values + chunk_offset, chunk_size);
+			}
+
+			return true;
+		}
+
+		template<typename IntegerType>
+		bool read_normalized(IntegerType* values, uint32_t num_elements)
+		{
+			float chunk[sjson_impl::k_conversion_chunk_size];
+
+			for (uint32_t chunk_offset = 0; chunk_offset < num_elements; chunk_offset += sjson_impl::k_conversion_chunk_size)
+			{
+				const uint32_t chunk_size = std::min(num_elements - chunk_offset, sjson_impl::k_conversion_chunk_size);
+				if (!read_float_chunk(chunk, chunk_size))
+					return false;
+
+				sjson_impl::convert_to_normalized(chunk, values + chunk_offset, chunk_size);
+			}
+
+			return true;
+		}
+
+		template<typename NumberType>
+		bool read_matrix(NumberType* values, uint32_t inner_size, uint32_t outer_count, size_t stride)
+		{
+			static_assert(std::is_arithmetic<NumberType>::value && !std::is_same<NumberType, bool>::value, "Matrices can only hold numbers");
+			SJSON_CPP_ASSERT(stride >= inner_size * sizeof(NumberType), "Matrix rows overlap, the stride must be at least %u bytes", uint32_t(inner_size * sizeof(NumberType)));
+
+			if (!array_begins())
+				return false;
+
+			char* row = reinterpret_cast<char*>(values);
+			for (uint32_t row_index = 0; row_index < outer_count; ++row_index)
+			{
+				if (!array_begins())
+					return false;
+
+				NumberType* row_values = reinterpret_cast<NumberType*>(row);
+				for (uint32_t column_index = 0; column_index < inner_size; ++column_index)
+				{
+					if (!read_value(row_values[column_index]))
+						return false;
+				}
+
+				if (!array_ends())
+					return false;
+
+				row += stride;
+			}
+
+			return array_ends();
+		}
+
+		// Array elements are not separated by commas in binary documents, this allows
+		// code templated on the reader type to remain identical.
+		bool read_comma() { return true; }
+
+		bool remainder_is_comments_and_whitespace()
+		{
+			if (!eof())
+			{
+				set_error(ParserError::UnexpectedContentAtEnd);
+				return false;
+			}
+
+			return true;
+		}
+
+		bool skip_comments_and_whitespace() { return true; }
+
+		// Attempts to read a 'null' literal.
+		// Returns true on success and the state is advanced otherwise
+		// the state remains unchanged and the function returns false.
+		bool try_read_null()
+		{
+			if (eof() || m_nodes[m_state.offset] != static_cast<uint8_t>(sjson_impl::BinaryNodeType::Null))
+				return false;
+
+			m_state.offset++;
+			return true;
+		}
+
+		bool eof() const { return m_state.offset >= m_nodes_size; }
+
+		ParserError get_error() const { return m_state.error; }
+		bool is_valid() const { return m_state.error.error == ParserError::None; }
+
+		BinaryReaderState save_state() const { return m_state; }
+		void restore_state(const BinaryReaderState& s) { m_state = s; }
+
+		void reset_state()
+		{
+			m_state = BinaryReaderState();
+
+			if (!m_is_document_valid)
+				set_error(ParserError::InvalidBinaryDocument);
+		}
+
+	private:
+		const uint8_t* m_strings;
+		const uint8_t* m_nodes;
+		size_t m_string_table_size;
+		size_t m_nodes_size;
+		bool m_is_document_valid;
+		BinaryReaderState m_state;
+
+		// Returns false when the end of the document is reached
+		bool peek_node_type(sjson_impl::BinaryNodeType& type)
+		{
+			if (eof())
+			{
+				set_error(ParserError::InputTruncated);
+				return false;
+			}
+
+			type = static_cast<sjson_impl::BinaryNodeType>(m_nodes[m_state.offset]);
+			return true;
+		}
+
+		bool read_node(sjson_impl::BinaryNodeType expected, uint32_t reason_if_other_found)
+		{
+			sjson_impl::BinaryNodeType type;
+			if (!peek_node_type(type))
+				return false;
+
+			if (type != expected)
+			{
+				set_error(reason_if_other_found);
+				return false;
+			}
+
+			m_state.offset++;
+			return true;
+		}
+
+		bool read_payload(void* payload, size_t payload_size)
+		{
+			if (payload_size > m_nodes_size - m_state.offset)
+			{
+				set_error(ParserError::InvalidBinaryDocument);
+				return false;
+			}
+
+			std::memcpy(payload, m_nodes + m_state.offset, payload_size);
+			m_state.offset += payload_size;
+			return true;
+		}
+
+		// Reads a node that refers to an entry in the string table
+		bool read_string_node(sjson_impl::BinaryNodeType expected, uint32_t reason_if_other_found, StringView& value)
+		{
+			const BinaryReaderState start_of_node = save_state();
+
+			uint32_t string_offset;
+			if (!read_node(expected, reason_if_other_found) || !read_payload(&string_offset, sizeof(string_offset)))
+				return false;
+
+			uint32_t length;
+			if (sizeof(length) > m_string_table_size || string_offset > m_string_table_size - sizeof(length))
+			{
+				restore_state(start_of_node);
+				set_error(ParserError::InvalidBinaryDocument);
+				return false;
+			}
+
+			std::memcpy(&length, m_strings + string_offset, sizeof(length));
+
+			const size_t string_start = size_t(string_offset) + sizeof(length);
+			if (length >= m_string_table_size - string_start)
+			{
+				restore_state(start_of_node);
+				set_error(ParserError::InvalidBinaryDocument);
+				return false;
+			}
+
+			value = StringView(reinterpret_cast<const char*>(m_strings + string_start), length);
+			return true;
+		}
+
+		bool read_key(const Key& having_name)
+		{
+			BinaryReaderState start_of_key = save_state();
+			StringView actual;
+
+			if (!read_key(actual))
+				return false;
+
+			if (having_name != actual)
+			{
+				restore_state(start_of_key);
+				set_error(ParserError::IncorrectKey);
+				return false;
+			}
+
+			return true;
+		}
+
+		bool read_key(StringView& key) { return read_string_node(sjson_impl::BinaryNodeType::Key, ParserError::KeyExpected, key); }
+
+		bool read_value(StringView& value) { return read_string_node(sjson_impl::BinaryNodeType::String, ParserError::QuotationMarkExpected, value); }
+
+		template<typename EnumType>
+		bool read_enum_value(EnumType& value, const EnumEntry<EnumType>* table, size_t num_entries)
+		{
+			BinaryReaderState start_of_string = save_state();
+
+			StringView name;
+			if (!read_value(name))
+				return false;
+
+			if (!sjson_impl::find_enum_value(name, table, num_entries, value))
+			{
+				restore_state(start_of_string);
+				set_error(ParserError::UnknownEnumValue);
+				return false;
+			}
+
+			return true;
+		}
+
+		bool read_value(bool& value)
+		{
+			sjson_impl::BinaryNodeType type;
+			if (!peek_node_type(type))
+				return false;
+
+			if (type != sjson_impl::BinaryNodeType::True && type != sjson_impl::BinaryNodeType::False)
+			{
+				set_error(ParserError::TrueOrFalseExpected);
+				return false;
+			}
+
+			value = type == sjson_impl::BinaryNodeType::True;
+			m_state.offset++;
+			return true;
+		}
+
+		bool read_value(double& value) { return read_double(value); }
+
+		bool read_float_chunk(float* chunk, uint32_t chunk_size)
+		{
+			for (uint32_t i = 0; i < chunk_size; ++i)
+			{
+				if (!read_value(chunk[i]))
+					return false;
+			}
+
+			return true;
+		}
+
+		bool read_value(float& value)
+		{
+			double dbl_value;
+			if (!read_double(dbl_value))
+				return false;
+
+			value = static_cast<float>(dbl_value);
+			return true;
+		}
+
+		template<typename IntegralType, typename std::enable_if<std::is_integral<IntegralType>::value>::type* = nullptr>
+		bool read_value(IntegralType& value) { return read_integer(value); }
+
+		// Numbers keep the representation they had in the source document, integers
+		// are converted on the fly. NaN and infinities are quoted strings like in the source.
+		bool read_double(double& value)
+		{
+			const BinaryReaderState start_of_value = save_state();
+
+			sjson_impl::BinaryNodeType type;
+			if (!peek_node_type(type))
+				return false;
+
+			m_state.offset++;
+
+			switch (type)
+			{
+			case sjson_impl::BinaryNodeType::Double:
+				return read_payload(&value, sizeof(value));
+			case sjson_impl::BinaryNodeType::Integer:
+			{
+				int64_t raw_value;
+				if (!read_payload(&raw_value, sizeof(raw_value)))
+					return false;
+
+				value = static_cast<double>(raw_value);
+				return true;
+			}
+			case sjson_impl::BinaryNodeType::UnsignedInteger:
+			{
+				uint64_t raw_value;
+				if (!read_payload(&raw_value, sizeof(raw_value)))
+					return false;
+
+				value = static_cast<double>(raw_value);
+				return true;
+			}
+			case sjson_impl::BinaryNodeType::String:
+			{
+				restore_state(start_of_value);
+
+				StringView literal;
+				if (!read_value(literal))
+					return false;
+
+				if (literal == "nan")
+				{
+					value = std::nan("");
+					return true;
+				}
+				else if (literal == "inf")
+				{
+					value = std::numeric_limits<double>::infinity();
+					return true;
+				}
+				else if (literal == "-inf")
+				{
+					value = -std::numeric_limits<double>::infinity();
+					return true;
+				}
+
+				break;
+			}
+			default:
+				break;
+			}
+
+			restore_state(start_of_value);
+			set_error(ParserError::NumberExpected);
+			return false;
+		}
+
+		template<typename IntegralType>
+		bool read_integer(IntegralType& value)
+		{
+			const BinaryReaderState start_of_value = save_state();
+
+			sjson_impl::BinaryNodeType type;
+			if (!peek_node_type(type))
+				return false;
+
+			if (type != sjson_impl::BinaryNodeType::Integer && type != sjson_impl::BinaryNodeType::UnsignedInteger)
+			{
+				set_error(ParserError::NumberExpected);
+				return false;
+			}
+
+			m_state.offset++;
+
+			bool is_in_range;
+			if (type == sjson_impl::BinaryNodeType::Integer)
+			{
+				int64_t raw_value;
+				if (!read_payload(&raw_value, sizeof(raw_value)))
+					return false;
+
+				value = static_cast<IntegralType>(raw_value);
+				is_in_range = static_cast<int64_t>(value) == raw_value && (raw_value >= 0 || std::is_signed<IntegralType>::value);
+			}
+			else
+			{
+				uint64_t raw_value;
+				if (!read_payload(&raw_value, sizeof(raw_value)))
+					return false;
+
+				value = static_cast<IntegralType>(raw_value);
+				is_in_range = static_cast<uint64_t>(value) == raw_value && std::is_unsigned<IntegralType>::value;
+			}
+
+			if (!is_in_range)
+			{
+				restore_state(start_of_value);
+				set_error(ParserError::NumberCouldNotBeConverted);
+				return false;
+			}
+
+			return true;
+		}
+
+		template<typename ValueType>
+		bool try_read_impl(const Key& key, ValueType& value, const ValueType& default_value)
+		{
+			BinaryReaderState s = save_state();
+
+			if (read_key(key))
+			{
+				if (try_read_null())
+				{
+					value = default_value;
+					return false;
+				}
+
+				if (read_value(value))
+					return true;
+			}
+
+			restore_state(s);
+			value = default_value;
+			return false;
+		}
+
+		template<typename ValueType>
+		bool try_read_array_impl(const Key& key, ValueType* values, uint32_t num_elements, const ValueType& default_value)
+		{
+			BinaryReaderState s = save_state();
+
+			if (read_key(key))
+			{
+				if (try_read_null())
+				{
+					std::fill(values, values + num_elements, default_value);
+					return false;
+				}
+
+				if (array_begins() && read(values, num_elements) && array_ends())
+					return true;
+			}
+
+			restore_state(s);
+			std::fill(values, values + num_elements, default_value);
+			return false;
+		}
+
+		void set_error(uint32_t error)
+		{
+			m_state.error.error = error;
+			m_state.error.line = 0;
+			m_state.error.column = static_cast<uint32_t>(m_state.offset);
+		}
+
+		friend sjson_impl::BinaryDecompiler;
+	};
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
@@ -0,0 +1,249 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/error.h"
+#include "sjson/key.h"
+#include "sjson/parser.h"
+#include "sjson/parser_error.h"
+#include "sjson/string_view.h"
+#include "sjson/version.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	enum class ColumnType : uint8_t
+	{
+		Double,
+		Float,
+		Int8,
+		UInt8,
+		Int16,
+		UInt16,
+		Int32,
+		UInt32,
+		Int64,
+		UInt64,
+		Bool,
+		String,
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Binds the key of an array element member to a column, see column_binding.
+	// The column must be large enough to hold a value for every element read.
+	//////////////////////////////////////////////////////////////////////////
+	struct ColumnBinding
+	{
+		Key key;
+		void* column;
+		ColumnType type;
+	};
+
+	inline ColumnBinding column_binding(const Key& key, double* column) { return ColumnBinding{ key, column, ColumnType::Double }; }
+	inline ColumnBinding column_binding(const Key& key, float* column) { return ColumnBinding{ key, column, ColumnType::Float }; }
+	inline ColumnBinding column_binding(const Key& key, int8_t* column) { return ColumnBinding{ key, column, ColumnType::Int8 }; }
+	inline ColumnBinding column_binding(const Key& key, uint8_t* column) { return ColumnBinding{ key, column, ColumnType::UInt8 }; }
+	inline ColumnBinding column_binding(const Key& key, int16_t* column) { return ColumnBinding{ key, column, ColumnType::Int16 }; }
+	inline ColumnBinding column_binding(const Key& key, uint16_t* column) { return ColumnBinding{ key, column, ColumnType::UInt16 }; }
+	inline ColumnBinding column_binding(const Key& key, int32_t* column) { return ColumnBinding{ key, column, ColumnType::Int32 }; }
+	inline ColumnBinding column_binding(const Key& key, uint32_t* column) { return ColumnBinding{ key, column, ColumnType::UInt32 }; }
+	inline ColumnBinding column_binding(const Key& key, int64_t* column) { return ColumnBinding{ key, column, ColumnType::Int64 }; }
+	inline ColumnBinding column_binding(const Key& key, uint64_t* column) { return ColumnBinding{ key, column, ColumnType::UInt64 }; }
+	inline ColumnBinding column_binding(const Key& key, bool* column) { return ColumnBinding{ key, column, ColumnType::Bool }; }
+
+	// The StringView values are raw views of the SJSON buffer, see Parser::read
+	inline ColumnBinding column_binding(const Key& key, StringView* column) { return ColumnBinding{ key, column, ColumnType::String }; }
+
+	namespace sjson_impl
+	{
+		constexpr uint32_t k_max_column_bindings = 32;
+
+		// The key order of the first element is remembered for this many members
+		constexpr uint32_t k_max_column_member_order = 64;
+
+		constexpr uint8_t k_unknown_column = 0xFF;
+
+		// Reads the value of a member into its column once its key has been consumed
+		inline bool read_column_value(Parser& parser, const ColumnBinding& binding, uint32_t index)
+		{
+			switch (binding.type)
+			{
+			case ColumnType::Double:	return ParserAccess::read_value(parser, static_cast<double*>(binding.column)[index]);
+			case ColumnType::Float:		return ParserAccess::read_value(parser, static_cast<float*>(binding.column)[index]);
+			case ColumnType::Int8:		return ParserAccess::read_value(parser, static_cast<int8_t*>(binding.column)[index]);
+			case ColumnType::UInt8:		return ParserAccess::read_value(parser, static_cast<uint8_t*>(binding.column)[index]);
+			case ColumnType::Int16:		return ParserAccess::read_value(parser, static_cast<int16_t*>(binding.column)[index]);
+			case ColumnType::UInt16:	return ParserAccess::read_value(parser, static_cast<uint16_t*>(binding.column)[index]);
+			case ColumnType::Int32:		return ParserAccess::read_value(parser, static_cast<int32_t*>(binding.column)[index]);
+			case ColumnType::UInt32:	return ParserAccess::read_value(parser, static_cast<uint32_t*>(binding.column)[index]);
+			case ColumnType::Int64:		return ParserAccess::read_value(parser, static_cast<int64_t*>(binding.column)[index]);
+			case ColumnType::UInt64:	return ParserAccess::read_value(parser, static_cast<uint64_t*>(binding.column)[index]);
+			case ColumnType::Bool:		return ParserAccess::read_value(parser, static_cast<bool*>(binding.column)[index]);
+			case ColumnType::String:	return ParserAccess::read_value(parser, static_cast<StringView*>(binding.column)[index]);
+			default:
+				SJSON_CPP_ASSERT(false, "Unknown column type: %u", static_cast<uint32_t>(binding.type));
+				return false;
+			}
+		}
+
+		inline bool is_column_key(const ColumnBinding& binding, const StringView& key, uint32_t hash)
+		{
+			return binding.key.get_hash() == hash && binding.key == key;
+		}
+
+		inline uint32_t find_column(const ColumnBinding* bindings, uint32_t num_bindings, const StringView& key, uint32_t hash)
+		{
+			for (uint32_t binding_index = 0; binding_index < num_bindings; ++binding_index)
+			{
+				if (is_column_key(bindings[binding_index], key, hash))
+					return binding_index;
+			}
+
+			return k_unknown_column;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Reads an array of objects into one column per bound member in a single pass,
+	// the element at index i of the array is written at index i of every column.
+	// Every bound member must be present in every element, other members are skipped.
+	//
+	// Elements usually list their members in the same order, the key order of the first
+	// element is remembered and later elements only compare each key with the one expected
+	// at its position. Keys are only searched for when an element deviates from that order.
+	//
+	// Reading fails with ParserError::BufferTooSmall if the array has more than max_elements
+	// elements and with ParserError::RequiredKeyMissing if an element lacks a bound member.
+	//
+	// e.g.:
+	//    tracks = [ { time = 0.1 value = 3.0 }, { time = 0.2 value = 4.0 } ]
+	//
+	//    float times[16];
+	//    double values[16];
+	//    const ColumnBinding bindings[] = { column_binding("time", times), column_binding("value", values) };
+	//
+	//    uint32_t num_tracks;
+	//    read_columns(parser, "tracks", bindings, 16, num_tracks);
+	//////////////////////////////////////////////////////////////////////////
+	inline bool read_columns(Parser& parser, const Key& key, const ColumnBinding* bindings, uint32_t num_bindings, uint32_t max_elements, uint32_t& num_elements)
+	{
+		SJSON_CPP_ASSERT(num_bindings <= sjson_impl::k_max_column_bindings, "Too many column bindings, the maximum is %u", sjson_impl::k_max_column_bindings);
+
+		num_elements = 0;
+
+		if (!parser.array_begins(key))
+			return false;
+
+		if (parser.try_array_ends())
+			return true;
+
+		const uint32_t all_columns = num_bindings == 32 ? ~0U : ((1U << num_bindings) - 1);
+
+		// The column of each member of the first element, in the order they appear
+		uint8_t member_order[sjson_impl::k_max_column_member_order];
+		uint32_t num_ordered_members = 0;
+
+		while (true)
+		{
+			if (num_elements >= max_elements)
+			{
+				sjson_impl::ParserAccess::set_error(parser, ParserError::BufferTooSmall);
+				return false;
+			}
+
+			if (!parser.object_begins())
+				return false;
+
+			uint32_t found_columns = 0;
+			uint32_t member_index = 0;
+
+			while (!parser.try_object_ends())
+			{
+				StringView member_key;
+				uint32_t hash;
+				if (!sjson_impl::ParserAccess::read_any_key(parser, member_key, hash))
+					return false;
+
+				uint32_t column_index;
+				if (member_index < num_ordered_members && member_order[member_index] != sjson_impl::k_unknown_column
+					&& sjson_impl::is_column_key(bindings[member_order[member_index]], member_key, hash))
+				{
+					column_index = member_order[member_index];
+				}
+				else
+				{
+					column_index = sjson_impl::find_column(bindings, num_bindings, member_key, hash);
+
+					if (num_elements == 0 && member_index < sjson_impl::k_max_column_member_order)
+					{
+						member_order[member_index] = uint8_t(column_index);
+						num_ordered_members = member_index + 1;
+					}
+				}
+
+				member_index++;
+
+				if (column_index == sjson_impl::k_unknown_column)
+				{
+					if (!parser.skip_value())
+						return false;
+
+					continue;
+				}
+
+				if (!sjson_impl::read_column_value(parser, bindings[column_index], num_elements))
+					return false;
+
+				found_columns |= 1U << column_index;
+			}
+
+			if (found_columns != all_columns)
+			{
+				sjson_impl::ParserAccess::set_error(parser, ParserError::RequiredKeyMissing);
+				return false;
+			}
+
+			num_elements++;
+
+			if (parser.try_array_ends())
+				return true;
+
+			if (!parser.read_comma())
+				return false;
+		}
+	}
+
+	template<size_t N>
+	inline bool read_columns(Parser& parser, const Key& key, const ColumnBinding (&bindings)[N], uint32_t max_elements, uint32_t& num_elements)
+	{
+		return read_columns(parser, key, bindings, uint32_t(N), max_elements, num_elements);
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
@@ -0,0 +1,919 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/parser.h"
+#include "sjson/parser_error.h"
+#include "sjson/string_view.h"
+#include "sjson/version.h"
+#include "sjson/writer.h"
+#include "sjson/impl/text_layout.impl.h"
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// A DocumentEditor patches an SJSON document while writing it to a StreamWriter.
+	// Every byte that is not touched by an edit is copied verbatim from the input,
+	// comments and formatting included; only the edited values are written through the writer.
+	//
+	// Values are addressed with a path of keys separated by dots, array elements with their index,
+	// e.g.: "settings.tracks.2.name". The empty path is the root object.
+	// Keys that contain a dot cannot be addressed. Paths always refer to the input document.
+	//
+	// Edits can be made in any order, they are kept until finish() writes the whole document.
+	// finish() resolves the paths of all the edits together in a single pass over the input, it
+	// stops reading once the last value is found. Setting or removing a value again replaces the
+	// previous edit of that value. Inserted keys are added at the end of their object and appended
+	// values at the end of their array, in the order in which they were added.
+	// finish() fails with ParserError::PathNotFound when a path does not lead to a value of the
+	// expected type, and with ParserError::EditConflict when an edit overlaps another one,
+	// e.g. setting a value within an object that is removed.
+	//
+	// The values are copied into the editor and are written by finish(): paths, keys, strings,
+	// and everything that writer functions reference must outlive it.
+	// Nothing is allocated: up to k_max_num_edits edits can be pending and each one holds its
+	// value inline in k_max_value_size bytes, an editor takes over 10 KB. Writer functions that
+	// capture more than that must capture by reference.
+	//
+	// e.g.:
+	//    DocumentEditor editor(input, input_size, file_stream_writer);
+	//    editor.insert("settings", "is_enabled", true);
+	//    editor.set("settings.quality", 3);
+	//    editor.finish();
+	//////////////////////////////////////////////////////////////////////////
+	class DocumentEditor
+	{
+	public:
+		static constexpr uint32_t k_max_num_edits = 64;
+
+		// The largest value that can be edited, writer functions included
+		static constexpr size_t k_max_value_size = 64;
+
+		DocumentEditor(const char* input, size_t input_length, StreamWriter& output, FloatFormat float_format = FloatFormat::Decimal)
+			: m_input(input)
+			, m_input_length(input_length)
+			, m_output(output)
+			, m_float_format(float_format)
+			, m_copied_offset(0)
+			, m_num_edits(0)
+			, m_error()
+		{}
+
+		~DocumentEditor() { clear_edits(); }
+
+		DocumentEditor(const DocumentEditor&) = delete;
+		DocumentEditor& operator=(const DocumentEditor&) = delete;
+
+		// Replaces an existing value, the value can be anything that ArrayWriter::push accepts
+		template<typename T>
+		bool set(const char* path, const T& value)
+		{
+			PendingEdit* edit = add_edit(EditType::Set, path);
+			if (edit == nullptr)
+				return false;
+
+			store_value(*edit, stored_value(value));
+			return true;
+		}
+
+		// Adds a new key at the end of an object, the value can be anything that ObjectWriter::insert accepts.
+		// The member is written on a line of its own unless the object is written on a single line, e.g.: { a = 1 }
+		template<typename T>
+		bool insert(const char* object_path, const KeyView& key, const T& value)
+		{
+			PendingEdit* edit = add_edit(EditType::Insert, object_path);
+			if (edit == nullptr)
+				return false;
+
+			edit->key = StringView(key.c_str(), key.size());
+			store_value(*edit, stored_value(value));
+			return true;
+		}
+
+		// Removes a key and its value from its object, along with its line and a comment that ends it if nothing else is on it
+		bool remove(const char* path)
+		{
+			return add_edit(EditType::Remove, path) != nullptr;
+		}
+
+		// Adds a value at the end of an array, the value can be anything that ArrayWriter::push accepts.
+		// The value is written on a line of its own when the last element is, on the same line otherwise.
+		template<typename T>
+		bool append(const char* array_path, const T& value)
+		{
+			PendingEdit* edit = add_edit(EditType::Append, array_path);
+			if (edit == nullptr)
+				return false;
+
+			store_value(*edit, stored_value(value));
+			return true;
+		}
+
+		// Writes the document with all the edits applied
+		bool finish()
+		{
+			if (!is_valid() || !resolve_paths())
+				return false;
+
+			for (uint32_t edit_index = 0; edit_index < m_num_edits; ++edit_index)
+			{
+				if (!place_edit(edit_index))
+					return false;
+			}
+
+			// Edits are kept in the order they were made, sort them by offset and keep that order for equal offsets
+			uint32_t sorted_edits[k_max_num_edits];
+			uint32_t num_sorted_edits = 0;
+			for (uint32_t edit_index = 0; edit_index < m_num_edits; ++edit_index)
+			{
+				if (m_edits[edit_index].is_superseded)
+					continue;
+
+				uint32_t sorted_index = num_sorted_edits++;
+				for (; sorted_index > 0 && m_edits[sorted_edits[sorted_index - 1]].start > m_edits[edit_index].start; --sorted_index)
+					sorted_edits[sorted_index] = sorted_edits[sorted_index - 1];
+
+				sorted_edits[sorted_index] = edit_index;
+			}
+
+			const PendingEdit* previous_edit = nullptr;
+			for (uint32_t sorted_index = 0; sorted_index < num_sorted_edits; ++sorted_index)
+			{
+				const PendingEdit& edit = m_edits[sorted_edits[sorted_index]];
+				const PendingEdit* next_edit = sorted_index + 1 < num_sorted_edits ? &m_edits[sorted_edits[sorted_index + 1]] : nullptr;
+
+				const bool follows_same_insertion = previous_edit != nullptr && is_same_insertion(*previous_edit, edit);
+				const bool precedes_same_insertion = next_edit != nullptr && is_same_insertion(edit, *next_edit);
+
+				if (!apply_edit(edit, follows_same_insertion, precedes_same_insertion))
+					return false;
+
+				previous_edit = &edit;
+			}
+
+			clear_edits();
+			return copy_until(m_input_length);
+		}
+
+		ParserError get_error() const { return m_error; }
+		bool is_valid() const { return m_error.error == ParserError::None; }
+
+	private:
+		typedef uint64_t EditMask;
+
+		static_assert(k_max_num_edits <= sizeof(EditMask) * 8, "Every pending edit needs a bit in the edit mask");
+
+		enum class EditType : uint8_t
+		{
+			Set,
+			Insert,
+			Remove,
+			Append,
+		};
+
+		// Offsets in the input of a value found from its path
+		struct ValueSpan
+		{
+			size_t key_start = 0;
+			size_t start = 0;
+			size_t end = 0;
+			size_t last_child_start = 0;
+			size_t last_child_end = 0;
+			bool has_key = false;
+			bool has_children = false;
+			bool is_root = false;
+		};
+
+		// An edit waiting for finish(), it replaces the input between its start and end offsets and insertions have an empty range
+		struct PendingEdit
+		{
+			StringView path;
+			size_t path_offset = 0;			// Where the segment of the path being resolved starts
+			size_t element_index = 0;		// The segment being resolved as an array element index
+			size_t search_offset = 0;		// Where the value was expected when the path does not lead to one
+			ValueSpan span;
+			bool is_resolved = false;
+			bool is_superseded = false;		// Replaced by a later edit of the same value
+
+			size_t start = 0;
+			size_t end = 0;
+			size_t value_start = 0;
+			size_t line_start = 0;			// Remove: where the line of the member starts, Append: where the line of the last element starts
+			size_t line_end = 0;			// Remove: where the line of the member ends, Append: where the last element starts
+			StringView key;
+			uint32_t indent_level = 0;
+			EditType type = EditType::Set;
+			bool is_on_new_line = false;
+			bool needs_separator = false;
+
+			void (*write_value)(const PendingEdit& edit, StreamWriter& output, FloatFormat float_format) = nullptr;
+			void (*destroy_value)(PendingEdit& edit) = nullptr;
+
+			alignas(16) unsigned char value[k_max_value_size];
+		};
+
+		const char* m_input;
+		size_t m_input_length;
+		StreamWriter& m_output;
+		FloatFormat m_float_format;
+		size_t m_copied_offset;
+		PendingEdit m_edits[k_max_num_edits];
+		uint32_t m_num_edits;
+		ParserError m_error;
+
+		// Values are copied as-is, except for character arrays which are kept as strings up to their first null terminator
+		template<typename T>
+		static const T& stored_value(const T& value) { return value; }
+
+		template<size_t N>
+		static StringView stored_value(const char (&value)[N]) { return StringView(value, sjson_impl::key_length(value, N - 1)); }
+
+		template<typename T>
+		static void store_value(PendingEdit& edit, const T& value)
+		{
+			static_assert(sizeof(T) <= k_max_value_size, "The value is too large to be edited, capture fewer variables or capture them by reference");
+			static_assert(alignof(T) <= 16, "The value is too strictly aligned to be edited");
+
+			new (edit.value) T(value);
+			edit.write_value = &write_value<T>;
+			edit.destroy_value = &destroy_value<T>;
+		}
+
+		template<typename T>
+		static void write_value(const PendingEdit& edit, StreamWriter& output, FloatFormat float_format)
+		{
+			const T& value = *reinterpret_cast<const T*>(edit.value);
+
+			if (edit.type == EditType::Insert && edit.is_on_new_line)
+			{
+				ObjectFragmentWriter member_writer(output, edit.indent_level, float_format);
+				member_writer.insert(KeyView(edit.key), value);
+			}
+			else
+			{
+				sjson_impl::ValueTokenWriter value_writer(output, edit.indent_level, float_format);
+				value_writer.write(value);
+			}
+		}
+
+		template<typename T>
+		static void destroy_value(PendingEdit& edit)
+		{
+			reinterpret_cast<T*>(edit.value)->~T();
+		}
+
+		// Returns the edit of the value if it was already set or removed with the same path, a new edit otherwise
+		PendingEdit* add_edit(EditType type, const char* path)
+		{
+			if (!is_valid())
+				return nullptr;
+
+			const StringView path_view = path != nullptr ? StringView(path) : StringView();
+			const bool is_replacement = type == EditType::Set || type == EditType::Remove;
+
+			PendingEdit* edit = nullptr;
+			for (uint32_t edit_index = 0; edit_index < m_num_edits && is_replacement && edit == nullptr; ++edit_index)
+			{
+				PendingEdit& other_edit = m_edits[edit_index];
+				if ((other_edit.type == EditType::Set || other_edit.type == EditType::Remove) && other_edit.path == path_view)
+				{
+					if (other_edit.destroy_value != nullptr)
+						other_edit.destroy_value(other_edit);
+
+					edit = &other_edit;
+				}
+			}
+
+			if (edit == nullptr)
+			{
+				if (m_num_edits >= k_max_num_edits)
+				{
+					set_error(ParserError::TooManyEdits, 0);
+					return nullptr;
+				}
+
+				edit = &m_edits[m_num_edits++];
+			}
+
+			*edit = PendingEdit();
+			edit->type = type;
+			edit->path = path_view;
+			return edit;
+		}
+
+		// Resolves the paths of every edit in a single pass over the input
+		bool resolve_paths()
+		{
+			EditMask root_edits = 0;
+			for (uint32_t edit_index = 0; edit_index < m_num_edits; ++edit_index)
+			{
+				PendingEdit& edit = m_edits[edit_index];
+				if (edit.path.empty())
+				{
+					edit.span.is_root = true;
+					edit.span.end = m_input_length;
+					edit.is_resolved = true;
+				}
+				else
+					root_edits |= EditMask(1) << edit_index;
+			}
+
+			if (root_edits == 0)
+				return true;
+
+			Parser parser(m_input, m_input_length);
+			ValueSpan root_span;
+			if (!resolve_members(parser, root_edits, 0, true, root_span))
+				return fail(parser);
+
+			return true;
+		}
+
+		// The segment of the path being resolved
+		static StringView get_path_segment(const PendingEdit& edit)
+		{
+			const char* segment = edit.path.c_str() + edit.path_offset;
+			const char* path_end = edit.path.c_str() + edit.path.size();
+
+			const char* segment_end = segment;
+			while (segment_end != path_end && *segment_end != '.')
+				segment_end++;
+
+			return StringView(segment, static_cast<size_t>(segment_end - segment));
+		}
+
+		void set_not_found(EditMask edits, size_t offset)
+		{
+			for (uint32_t edit_index = 0; edits != 0; ++edit_index, edits >>= 1)
+			{
+				if ((edits & 1) != 0)
+					m_edits[edit_index].search_offset = offset;
+			}
+		}
+
+		// Looks for the members that the edits in the mask lead to, the opening brace has been consumed unless it is the root object.
+		// The root object is read until every path is resolved, other objects are read until they end.
+		bool resolve_members(Parser& parser, EditMask edits, uint32_t depth, bool is_root, ValueSpan& span)
+		{
+			while (true)
+			{
+				if (is_root)
+				{
+					if (edits == 0)
+						return true;
+
+					if (!parser.skip_comments_and_whitespace())
+						return false;
+
+					if (parser.eof())
+						break;
+				}
+				else if (parser.try_object_ends())
+					break;
+
+				size_t key_start;
+				StringView key;
+				if (!read_key(parser, key, key_start))
+					return false;
+
+				if (!parser.skip_comments_and_whitespace_fail_if_eof())
+					return false;
+
+				// The first member with the key is used
+				EditMask matched_edits = 0;
+				for (uint32_t edit_index = 0; edit_index < m_num_edits; ++edit_index)
+				{
+					const EditMask edit_bit = EditMask(1) << edit_index;
+					if ((edits & edit_bit) != 0 && get_path_segment(m_edits[edit_index]) == key)
+						matched_edits |= edit_bit;
+				}
+
+				edits &= ~matched_edits;
+
+				span.last_child_start = key_start;
+				if (!resolve_value(parser, matched_edits, depth, key_start, true))
+					return false;
+
+				span.last_child_end = parser.m_state.offset;
+				span.has_children = true;
+			}
+
+			set_not_found(edits, is_root ? m_input_length : parser.m_state.offset - 1);
+			return true;
+		}
+
+		// Looks for the elements that the edits in the mask lead to, the opening bracket has been consumed
+		bool resolve_elements(Parser& parser, EditMask edits, uint32_t depth, ValueSpan& span)
+		{
+			for (uint32_t edit_index = 0; edit_index < m_num_edits; ++edit_index)
+			{
+				const EditMask edit_bit = EditMask(1) << edit_index;
+				if ((edits & edit_bit) == 0)
+					continue;
+
+				PendingEdit& edit = m_edits[edit_index];
+				const StringView segment = get_path_segment(edit);
+
+				bool is_index = !segment.empty();
+				edit.element_index = 0;
+				for (size_t offset = 0; offset < segment.size() && is_index; ++offset)
+				{
+					is_index = segment[offset] >= '0' && segment[offset] <= '9' && edit.element_index <= (~size_t(0) - 9) / 10;
+					edit.element_index = edit.element_index * 10 + static_cast<size_t>(segment[offset] - '0');
+				}
+
+				if (!is_index)
+				{
+					edit.search_offset = parser.m_state.offset - 1;
+					edits &= ~edit_bit;
+				}
+			}
+
+			if (parser.try_array_ends())
+			{
+				set_not_found(edits, parser.m_state.offset - 1);
+				return true;
+			}
+
+			for (size_t element_index = 0; ; ++element_index)
+			{
+				if (!parser.skip_comments_and_whitespace_fail_if_eof())
+					return false;
+
+				const size_t value_start = parser.m_state.offset;
+
+				EditMask matched_edits = 0;
+				for (uint32_t edit_index = 0; edit_index < m_num_edits; ++edit_index)
+				{
+					const EditMask edit_bit = EditMask(1) << edit_index;
+					if ((edits & edit_bit) != 0 && m_edits[edit_index].element_index == element_index)
+						matched_edits |= edit_bit;
+				}
+
+				edits &= ~matched_edits;
+
+				span.last_child_start = value_start;
+				if (!resolve_value(parser, matched_edits, depth, value_start, false))
+					return false;
+
+				span.last_child_end = parser.m_state.offset;
+				span.has_children = true;
+
+				if (parser.try_array_ends())
+					break;
+
+				if (!parser.read_comma())
+					return false;
+			}
+
+			set_not_found(edits, parser.m_state.offset - 1);
+			return true;
+		}
+
+		// The segment of every edit in the mask matched the value, the parser is positioned at its start and is left at its end
+		bool resolve_value(Parser& parser, EditMask edits, uint32_t depth, size_t key_start, bool has_key)
+		{
+			EditMask resolved_edits = 0;
+			EditMask prefix_edits = 0;
+			for (uint32_t edit_index = 0; edit_index < m_num_edits; ++edit_index)
+			{
+				const EditMask edit_bit = EditMask(1) << edit_index;
+				if ((edits & edit_bit) == 0)
+					continue;
+
+				PendingEdit& edit = m_edits[edit_index];
+				edit.path_offset += get_path_segment(edit).size();
+
+				if (edit.path_offset == edit.path.size())
+					resolved_edits |= edit_bit;
+				else
+				{
+					edit.path_offset++;		// Skip the dot
+					prefix_edits |= edit_bit;
+				}
+			}
+
+			ValueSpan span;
+			span.key_start = key_start;
+			span.start = parser.m_state.offset;
+			span.has_key = has_key;
+
+			const bool is_container = parser.m_state.symbol == '{' || parser.m_state.symbol == '[';
+			if (prefix_edits != 0 && is_container)
+			{
+				if (depth == Parser::k_max_skip_depth)
+				{
+					parser.set_error(ParserError::NestingTooDeep);
+					return false;
+				}
+
+				const bool is_object = parser.m_state.symbol == '{';
+				parser.advance();
+
+				const bool is_valid_value = is_object ? resolve_members(parser, prefix_edits, depth + 1, false, span) : resolve_elements(parser, prefix_edits, depth + 1, span);
+				if (!is_valid_value)
+					return false;
+			}
+			else
+			{
+				// Nothing can be found within a string, a number, or a literal
+				set_not_found(prefix_edits, span.start);
+
+				if (resolved_edits != 0)
+				{
+					if (!skip_value(parser, span.last_child_start, span.last_child_end, span.has_children))
+						return false;
+				}
+				else if (!parser.skip_value())
+					return false;
+			}
+
+			span.end = parser.m_state.offset;
+
+			for (uint32_t edit_index = 0; edit_index < m_num_edits; ++edit_index)
+			{
+				if ((resolved_edits & (EditMask(1) << edit_index)) != 0)
+				{
+					m_edits[edit_index].span = span;
+					m_edits[edit_index].is_resolved = true;
+				}
+			}
+
+			return true;
+		}
+
+		// Finds where the edit writes in the input now that its value is known, edits are placed in the order they were made
+		bool place_edit(uint32_t edit_index)
+		{
+			PendingEdit& edit = m_edits[edit_index];
+			if (!edit.is_resolved)
+			{
+				set_error(ParserError::PathNotFound, edit.search_offset);
+				return false;
+			}
+
+			const ValueSpan& span = edit.span;
+
+			switch (edit.type)
+			{
+			case EditType::Set:
+				if (!require_value(span) || !place_replacement(edit_index, span.start))
+					return false;
+
+				edit.indent_level = sjson_impl::get_indent_level(m_input, m_input_length, span.key_start);
+				return true;
+			case EditType::Insert:
+			{
+				size_t insert_offset;
+				uint32_t indent_level;
+				bool is_on_new_line = true;
+				bool needs_separator = false;
+
+				if (span.is_root)
+				{
+					const size_t line_start_offset = sjson_impl::find_line_start(m_input, m_input_length);
+					needs_separator = line_start_offset == sjson_impl::k_invalid_offset;
+					insert_offset = needs_separator ? m_input_length : line_start_offset;
+					indent_level = 0;
+				}
+				else
+				{
+					if (m_input[span.start] != '{')
+					{
+						set_error(ParserError::OpeningBraceExpected, span.start);
+						return false;
+					}
+
+					const size_t closing_offset = span.end - 1;
+					indent_level = sjson_impl::get_indent_level(m_input, m_input_length, closing_offset);
+					insert_offset = sjson_impl::find_line_start(m_input, closing_offset);
+
+					if (insert_offset != sjson_impl::k_invalid_offset)
+						indent_level++;
+					else
+					{
+						// The object is on a single line, the member is added inline after the last one
+						insert_offset = closing_offset;
+						while (m_input[insert_offset - 1] == ' ' || m_input[insert_offset - 1] == '\t')
+							insert_offset--;
+
+						is_on_new_line = false;
+						needs_separator = insert_offset == closing_offset;
+					}
+				}
+
+				if (!place(edit_index, insert_offset, insert_offset))
+					return false;
+
+				edit.indent_level = indent_level;
+				edit.is_on_new_line = is_on_new_line;
+				edit.needs_separator = needs_separator;
+				return true;
+			}
+			case EditType::Remove:
+				if (!require_value(span))
+					return false;
+
+				if (!span.has_key)
+				{
+					set_error(ParserError::PathNotFound, span.start);
+					return false;
+				}
+
+				if (!place_replacement(edit_index, span.key_start))
+					return false;
+
+				edit.line_start = sjson_impl::find_line_start(m_input, span.key_start);
+				edit.line_end = sjson_impl::find_line_end(m_input, m_input_length, span.end);
+				return true;
+			case EditType::Append:
+			default:
+			{
+				if (!require_value(span))
+					return false;
+
+				if (m_input[span.start] != '[')
+				{
+					set_error(ParserError::OpeningBracketExpected, span.start);
+					return false;
+				}
+
+				const size_t insert_offset = span.has_children ? span.last_child_end : span.start + 1;
+				if (!place(edit_index, insert_offset, insert_offset))
+					return false;
+
+				edit.indent_level = sjson_impl::get_indent_level(m_input, m_input_length, span.key_start);
+				edit.needs_separator = span.has_children;
+
+				const size_t line_start_offset = span.has_children ? sjson_impl::find_line_start(m_input, span.last_child_start) : sjson_impl::k_invalid_offset;
+				if (line_start_offset != sjson_impl::k_invalid_offset)
+				{
+					// Indent the value like the last element
+					edit.is_on_new_line = true;
+					edit.line_start = line_start_offset;
+					edit.line_end = span.last_child_start;
+					edit.indent_level = sjson_impl::get_indent_level(m_input, m_input_length, span.last_child_start);
+				}
+
+				return true;
+			}
+			}
+		}
+
+		// A previous edit of the same value reached through a different path is superseded
+		bool place_replacement(uint32_t edit_index, size_t start_offset)
+		{
+			PendingEdit& edit = m_edits[edit_index];
+
+			for (uint32_t other_index = 0; other_index < edit_index; ++other_index)
+			{
+				PendingEdit& other_edit = m_edits[other_index];
+				if (!other_edit.is_superseded && other_edit.start != other_edit.end && other_edit.value_start == edit.span.start && other_edit.end == edit.span.end)
+					other_edit.is_superseded = true;
+			}
+
+			edit.value_start = edit.span.start;
+			return place(edit_index, start_offset, edit.span.end);
+		}
+
+		bool place(uint32_t edit_index, size_t start_offset, size_t end_offset)
+		{
+			for (uint32_t other_index = 0; other_index < edit_index; ++other_index)
+			{
+				// Insertions overlap the ranges they fall strictly within
+				const PendingEdit& other_edit = m_edits[other_index];
+				if (!other_edit.is_superseded && start_offset < other_edit.end && other_edit.start < end_offset)
+				{
+					set_error(ParserError::EditConflict, start_offset);
+					return false;
+				}
+			}
+
+			m_edits[edit_index].start = start_offset;
+			m_edits[edit_index].end = end_offset;
+			return true;
+		}
+
+		// Whether both edits add a value at the same location, the first one precedes the second one
+		static bool is_same_insertion(const PendingEdit& edit, const PendingEdit& next_edit)
+		{
+			return edit.start == edit.end && next_edit.start == next_edit.end && edit.start == next_edit.start && edit.type == next_edit.type;
+		}
+
+		bool apply_edit(const PendingEdit& edit, bool follows_same_insertion, bool precedes_same_insertion)
+		{
+			size_t start_offset = edit.start;
+			size_t end_offset = edit.end;
+
+			if (edit.type == EditType::Remove && edit.line_start != sjson_impl::k_invalid_offset && edit.line_end != sjson_impl::k_invalid_offset && edit.line_start >= m_copied_offset)
+			{
+				start_offset = edit.line_start;
+				end_offset = edit.line_end;
+			}
+
+			if (!copy_until(start_offset))
+				return false;
+
+			switch (edit.type)
+			{
+			case EditType::Set:
+				edit.write_value(edit, m_output, m_float_format);
+				break;
+			case EditType::Insert:
+				if (edit.is_on_new_line)
+				{
+					// The root object does not end with a line terminator
+					if (edit.needs_separator && !follows_same_insertion)
+						m_output.write(k_line_terminator);
+
+					edit.write_value(edit, m_output, m_float_format);
+				}
+				else
+				{
+					m_output.write(" ");
+					sjson_impl::write_key(m_output, KeyView(edit.key));
+					m_output.write(" = ");
+					edit.write_value(edit, m_output, m_float_format);
+
+					// The closing brace directly follows the last member
+					if (edit.needs_separator && !precedes_same_insertion)
+						m_output.write(" ");
+				}
+				break;
+			case EditType::Remove:
+				break;
+			case EditType::Append:
+				if (edit.is_on_new_line)
+				{
+					m_output.write(",");
+					m_output.write(k_line_terminator);
+					m_output.write(m_input + edit.line_start, edit.line_end - edit.line_start);
+				}
+				else
+					m_output.write(edit.needs_separator || follows_same_insertion ? ", " : " ");
+
+				edit.write_value(edit, m_output, m_float_format);
+				break;
+			}
+
+			m_copied_offset = end_offset;
+			return true;
+		}
+
+		void clear_edits()
+		{
+			for (uint32_t edit_index = 0; edit_index < m_num_edits; ++edit_index)
+			{
+				if (m_edits[edit_index].destroy_value != nullptr)
+					m_edits[edit_index].destroy_value(m_edits[edit_index]);
+			}
+
+			m_num_edits = 0;
+		}
+
+		static bool read_key(Parser& parser, StringView& key, size_t& key_start)
+		{
+			if (!parser.skip_comments_and_whitespace_fail_if_eof())
+				return false;
+
+			key_start = parser.m_state.offset;
+
+			if (parser.m_state.symbol == '"')
+			{
+				if (!parser.read_string(key))
+					return false;
+			}
+			else if (!parser.read_unquoted_key(key))
+				return false;
+
+			return parser.read_equal_sign();
+		}
+
+		// Skips over a value of any type and finds where its last member or element starts and ends
+		static bool skip_value(Parser& parser, size_t& last_child_start, size_t& last_child_end, bool& has_children)
+		{
+			last_child_start = 0;
+			last_child_end = 0;
+			has_children = false;
+
+			if (!parser.skip_comments_and_whitespace_fail_if_eof())
+				return false;
+
+			switch (parser.m_state.symbol)
+			{
+			case '{':
+				parser.advance();
+
+				while (!parser.try_object_ends())
+				{
+					StringView key;
+					if (!read_key(parser, key, last_child_start) || !parser.skip_value())
+						return false;
+
+					last_child_end = parser.m_state.offset;
+					has_children = true;
+				}
+
+				return true;
+			case '[':
+				parser.advance();
+
+				if (parser.try_array_ends())
+					return true;
+
+				while (true)
+				{
+					if (!parser.skip_comments_and_whitespace_fail_if_eof())
+						return false;
+
+					last_child_start = parser.m_state.offset;
+
+					if (!parser.skip_value())
+						return false;
+
+					last_child_end = parser.m_state.offset;
+					has_children = true;
+
+					if (parser.try_array_ends())
+						return true;
+
+					if (!parser.read_comma())
+						return false;
+				}
+			default:
+				return parser.skip_value();
+			}
+		}
+
+		bool require_value(const ValueSpan& span)
+		{
+			if (span.is_root)
+			{
+				set_error(ParserError::PathNotFound, 0);
+				return false;
+			}
+
+			return true;
+		}
+
+		bool copy_until(size_t offset)
+		{
+			if (!is_valid())
+				return false;
+
+			if (offset < m_copied_offset)
+			{
+				set_error(ParserError::EditConflict, offset);
+				return false;
+			}
+
+			if (offset > m_copied_offset)
+				m_output.write(m_input + m_copied_offset, offset - m_copied_offset);
+
+			m_copied_offset = offset;
+			return true;
+		}
+
+		bool fail(const Parser& parser)
+		{
+			m_error = parser.get_error();
+			return false;
+		}
+
+		void set_error(uint32_t error, size_t offset)
+		{
+			m_error.error = error;
+			sjson_impl::get_line_and_column(m_input, m_input_length, offset, m_error.line, m_error.column);
+		}
+	};
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
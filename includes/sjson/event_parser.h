@@ -0,0 +1,352 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/parser.h"
+#include "sjson/parser_error.h"
+#include "sjson/string_view.h"
+#include "sjson/version.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Receives the events of an EventParser in document order.
+	// Every event does nothing by default, override the ones you need.
+	//////////////////////////////////////////////////////////////////////////
+	class ParseVisitor
+	{
+	public:
+		virtual ~ParseVisitor() = default;
+
+		virtual void on_object_begin() {}
+		virtual void on_object_end() {}
+		virtual void on_array_begin() {}
+		virtual void on_array_end() {}
+
+		// The raw key, quoted keys are provided without their quotation marks and are not unescaped
+		virtual void on_key(const StringView& key) { (void)key; }
+
+		// The raw string without its quotation marks, nothing is unescaped
+		virtual void on_string(const StringView& value) { (void)value; }
+
+		// The raw number as written, e.g.: -1.5e3 or 0x1p-2
+		// Its syntax is validated but conversion is left to the visitor, see sjson/number_token.h
+		virtual void on_number(const StringView& value) { (void)value; }
+
+		virtual void on_bool(bool value) { (void)value; }
+		virtual void on_null() {}
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// An EventParser walks the remainder of a parser's input in a single pass and
+	// reports what it finds to a ParseVisitor: keys, values, and where objects and arrays
+	// begin and end. It never backtracks and does not recurse, the containers it is in
+	// are tracked in a fixed size stack. The root object is implicit, no event
+	// is reported for it.
+	//
+	// e.g.:
+	//    Parser parser(input, input_length);
+	//    EventParser event_parser(parser, visitor);
+	//    if (!event_parser.run())
+	//        ParserError error = parser.get_error();
+	//
+	// The walk can also be spread over several calls with a budget, e.g.: once per frame.
+	// It stops after the token that exhausts the budget and the next call picks up from there,
+	// the parser, the visitor, and the input must remain alive in between.
+	//
+	// e.g.:
+	//    // Every frame
+	//    if (!event_parser.is_done() && !event_parser.run_for(std::chrono::microseconds(500)))
+	//        ParserError error = parser.get_error();
+	//////////////////////////////////////////////////////////////////////////
+	class EventParser
+	{
+	public:
+		// Maximum number of nested objects and arrays
+		static constexpr uint32_t k_max_depth = 64;
+
+		EventParser(Parser& parser, ParseVisitor& visitor)
+			: m_parser(parser)
+			, m_visitor(visitor)
+			, m_state(State::Member)
+			, m_depth(0)
+		{
+			m_is_array[0] = false;
+		}
+
+		EventParser(const EventParser&) = delete;
+		EventParser& operator=(const EventParser&) = delete;
+
+		// Walks the remainder of the input, returns false if it could not be parsed; the parser then holds the error
+		bool run()
+		{
+			while (m_state != State::Done)
+			{
+				if (!step())
+					return false;
+			}
+
+			return true;
+		}
+
+		// Walks the input until at least byte_budget bytes have been consumed or the input ends,
+		// at least one token is consumed per call. Returns false if it could not be parsed.
+		bool run_for(size_t byte_budget)
+		{
+			const size_t end_offset = m_parser.m_state.offset + byte_budget;
+
+			do
+			{
+				if (!step())
+					return false;
+			} while (m_state != State::Done && m_parser.m_state.offset < end_offset);
+
+			return true;
+		}
+
+		// Walks the input until the time budget is spent or the input ends,
+		// at least one token is consumed per call. Returns false if it could not be parsed.
+		// The clock is only read every few tokens, the budget can be exceeded by the time they take.
+		bool run_for(std::chrono::nanoseconds time_budget)
+		{
+			const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + time_budget;
+
+			while (true)
+			{
+				for (uint32_t step_index = 0; step_index < k_num_steps_per_clock_read; ++step_index)
+				{
+					if (!step())
+						return false;
+
+					if (m_state == State::Done)
+						return true;
+				}
+
+				if (std::chrono::steady_clock::now() >= deadline)
+					return true;
+			}
+		}
+
+		// Whether the whole input has been walked
+		bool is_done() const { return m_state == State::Done; }
+
+	private:
+		static constexpr uint32_t k_num_steps_per_clock_read = 32;
+
+		enum class State : uint8_t
+		{
+			Member,			// A key or the end of the object is expected
+			Value,			// A value is expected
+			FirstElement,	// A value or the end of the array is expected
+			NextElement,	// A comma or the end of the array is expected
+			Done,
+		};
+
+		Parser& m_parser;
+		ParseVisitor& m_visitor;
+		State m_state;
+
+		// m_is_array[0] is the implicit root object
+		uint32_t m_depth;
+		bool m_is_array[k_max_depth + 1];
+
+		// Consumes a single token and reports it
+		bool step()
+		{
+			Parser& parser = m_parser;
+
+			switch (m_state)
+			{
+			case State::Member:
+				if (m_depth == 0)
+				{
+					if (!parser.skip_comments_and_whitespace())
+						return false;
+
+					if (parser.eof())
+					{
+						m_state = State::Done;
+						return true;
+					}
+				}
+				else
+				{
+					if (!parser.skip_comments_and_whitespace_fail_if_eof())
+						return false;
+
+					if (parser.m_state.symbol == '}')
+					{
+						parser.advance();
+						m_visitor.on_object_end();
+						end_container();
+						return true;
+					}
+				}
+
+				{
+					StringView key;
+					if (!parser.read_any_key(key))
+						return false;
+
+					m_visitor.on_key(key);
+					m_state = State::Value;
+				}
+				return true;
+			case State::FirstElement:
+				if (!parser.skip_comments_and_whitespace_fail_if_eof())
+					return false;
+
+				if (parser.m_state.symbol == ']')
+				{
+					parser.advance();
+					m_visitor.on_array_end();
+					end_container();
+				}
+				else
+					m_state = State::Value;
+				return true;
+			case State::NextElement:
+				if (!parser.skip_comments_and_whitespace_fail_if_eof())
+					return false;
+
+				if (parser.m_state.symbol == ']')
+				{
+					parser.advance();
+					m_visitor.on_array_end();
+					end_container();
+					return true;
+				}
+
+				if (!parser.read_comma())
+					return false;
+
+				m_state = State::Value;
+				return true;
+			case State::Value:
+				return step_value();
+			case State::Done:
+			default:
+				return true;
+			}
+		}
+
+		bool step_value()
+		{
+			Parser& parser = m_parser;
+
+			if (!parser.skip_comments_and_whitespace_fail_if_eof())
+				return false;
+
+			switch (parser.m_state.symbol)
+			{
+			case '{':
+				if (!begin_container(false))
+					return false;
+
+				parser.advance();
+				m_visitor.on_object_begin();
+				m_state = State::Member;
+				return true;
+			case '[':
+				if (!begin_container(true))
+					return false;
+
+				parser.advance();
+				m_visitor.on_array_begin();
+				m_state = State::FirstElement;
+				return true;
+			case '"':
+			{
+				StringView value;
+				if (!parser.read_string(value))
+					return false;
+
+				m_visitor.on_string(value);
+				break;
+			}
+			case 'n':
+			case 't':
+			case 'f':
+			{
+				if (parser.try_read_null())
+				{
+					m_visitor.on_null();
+					break;
+				}
+
+				bool value;
+				if (!parser.read_bool(value))
+					return false;
+
+				m_visitor.on_bool(value);
+				break;
+			}
+			default:
+			{
+				StringView value;
+				if (!parser.read_number_token(value))
+					return false;
+
+				m_visitor.on_number(value);
+				break;
+			}
+			}
+
+			end_value();
+			return true;
+		}
+
+		bool begin_container(bool is_array)
+		{
+			if (m_depth == k_max_depth)
+			{
+				m_parser.set_error(ParserError::NestingTooDeep);
+				return false;
+			}
+
+			m_is_array[++m_depth] = is_array;
+			return true;
+		}
+
+		void end_container()
+		{
+			m_depth--;
+			end_value();
+		}
+
+		void end_value()
+		{
+			m_state = m_is_array[m_depth] ? State::NextElement : State::Member;
+		}
+	};
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
@@ -40,18 +40,57 @@ namespace sjson
     // Core
     class runtime_assert;
     class StringView;
+    class Key;
+    template<typename EnumType> struct EnumEntry;
 
     // Parser
     struct ParserError;
     struct ParserState;
+    struct MutableInput;
     class Parser;
 
     // Writer
     class StreamWriter;
+    class KeyView;
     class FileStreamWriter;
+    class CountingStreamWriter;
+    class BufferStreamWriter;
     class ArrayWriter;
     class ObjectWriter;
     class Writer;
+    class ObjectFragmentWriter;
+
+    // Binary
+    struct BinaryReaderState;
+    class BinaryReader;
+    struct ParseCacheKey;
+
+    // Editing
+    class DocumentEditor;
+    class TransformContext;
+    class TransformHandler;
+    class StreamTransform;
+
+    // Visiting
+    class EventParser;
+    class ParseVisitor;
+
+    // Querying
+    class PathQuery;
+    class QueryHandler;
+
+    // Schemas
+    template<typename StructType, typename MemberType> struct SchemaField;
+    template<typename StructType, typename... FieldTypes> class Schema;
+
+    // Columns
+    struct ColumnBinding;
+
+    // Records
+    class RecordSplitter;
+    class RecordHandler;
+    struct RecordError;
+    class ParallelRecordReader;
 
     SJSON_CPP_IMPL_VERSION_NAMESPACE_END
 }
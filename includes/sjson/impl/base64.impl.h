@@ -0,0 +1,206 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/version.h"
+#include "sjson/impl/simd.impl.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Standard base64 encoding (RFC 4648) with padding.
+		//////////////////////////////////////////////////////////////////////////
+
+		constexpr size_t get_base64_encoded_size(size_t size) { return ((size + 2) / 3) * 4; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Encodes the input and returns the number of characters written.
+		// The destination must hold at least get_base64_encoded_size(size) characters.
+		//////////////////////////////////////////////////////////////////////////
+		inline size_t encode_base64(const uint8_t* src, size_t size, char* dst)
+		{
+			const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+			char* dst_start = dst;
+			size_t offset = 0;
+
+			for (; offset + 3 <= size; offset += 3)
+			{
+				const uint32_t bits = (uint32_t(src[offset]) << 16) | (uint32_t(src[offset + 1]) << 8) | uint32_t(src[offset + 2]);
+				dst[0] = alphabet[(bits >> 18) & 0x3F];
+				dst[1] = alphabet[(bits >> 12) & 0x3F];
+				dst[2] = alphabet[(bits >> 6) & 0x3F];
+				dst[3] = alphabet[bits & 0x3F];
+				dst += 4;
+			}
+
+			const size_t num_remaining = size - offset;
+			if (num_remaining != 0)
+			{
+				const uint32_t bits = (uint32_t(src[offset]) << 16) | (num_remaining == 2 ? (uint32_t(src[offset + 1]) << 8) : 0);
+				dst[0] = alphabet[(bits >> 18) & 0x3F];
+				dst[1] = alphabet[(bits >> 12) & 0x3F];
+				dst[2] = num_remaining == 2 ? alphabet[(bits >> 6) & 0x3F] : '=';
+				dst[3] = '=';
+				dst += 4;
+			}
+
+			return static_cast<size_t>(dst - dst_start);
+		}
+
+		// Returns the 6 bit value of a base64 character or 0xFF if it isn't part of the alphabet
+		inline uint8_t get_base64_value(char value)
+		{
+			if (value >= 'A' && value <= 'Z')
+				return static_cast<uint8_t>(value - 'A');
+			if (value >= 'a' && value <= 'z')
+				return static_cast<uint8_t>(value - 'a' + 26);
+			if (value >= '0' && value <= '9')
+				return static_cast<uint8_t>(value - '0' + 52);
+			if (value == '+')
+				return 62;
+			if (value == '/')
+				return 63;
+			return 0xFF;
+		}
+
+#if defined(SJSON_CPP_IMPL_SSE2_INTRINSICS)
+		// Decodes 16 characters into 12 bytes. Returns false if a character isn't part of the alphabet.
+		inline bool decode_base64_block_sse2(const char* src, uint8_t* dst)
+		{
+			const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+			// Characters above 127 are negative and fall outside of every range
+			const __m128i is_upper = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('Z' + 1)));
+			const __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('z' + 1)));
+			const __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+			const __m128i is_plus = _mm_cmpeq_epi8(chars, _mm_set1_epi8('+'));
+			const __m128i is_slash = _mm_cmpeq_epi8(chars, _mm_set1_epi8('/'));
+
+			const __m128i is_valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(is_upper, is_lower), _mm_or_si128(is_digit, is_plus)), is_slash);
+			if (_mm_movemask_epi8(is_valid) != 0xFFFF)
+				return false;
+
+			const __m128i delta = _mm_or_si128(
+				_mm_or_si128(_mm_and_si128(is_upper, _mm_set1_epi8(-'A')), _mm_and_si128(is_lower, _mm_set1_epi8(26 - 'a'))),
+				_mm_or_si128(_mm_or_si128(_mm_and_si128(is_digit, _mm_set1_epi8(52 - '0')), _mm_and_si128(is_plus, _mm_set1_epi8(62 - '+'))), _mm_and_si128(is_slash, _mm_set1_epi8(63 - '/'))));
+			const __m128i values = _mm_add_epi8(chars, delta);
+
+			// Merge pairs of 6 bit values into 12 bits and then pairs of those into 24 bits
+			const __m128i merged12 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00FF)), 6), _mm_srli_epi16(values, 8));
+			const __m128i merged24 = _mm_madd_epi16(merged12, _mm_set1_epi32(0x00011000));
+
+			uint32_t lanes[4];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&lanes[0]), merged24);
+
+			for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			{
+				dst[0] = static_cast<uint8_t>(lanes[lane_index] >> 16);
+				dst[1] = static_cast<uint8_t>(lanes[lane_index] >> 8);
+				dst[2] = static_cast<uint8_t>(lanes[lane_index]);
+				dst += 3;
+			}
+
+			return true;
+		}
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decodes the input straight into the destination which must be exactly 'dst_size' bytes.
+		// The input must be padded and its length must match the destination size.
+		// Returns false if the input is malformed.
+		//////////////////////////////////////////////////////////////////////////
+		inline bool decode_base64(const char* src, size_t src_length, uint8_t* dst, size_t dst_size)
+		{
+			if (src_length != get_base64_encoded_size(dst_size))
+				return false;
+
+			if (dst_size == 0)
+				return true;
+
+			// The last group of 4 characters holds the padding, if any
+			const size_t num_full_groups = (dst_size / 3) - (dst_size % 3 == 0 ? 1 : 0);
+			const size_t num_full_chars = num_full_groups * 4;
+			size_t src_offset = 0;
+
+#if defined(SJSON_CPP_IMPL_SSE2_INTRINSICS)
+			for (; src_offset + 16 <= num_full_chars; src_offset += 16)
+			{
+				if (!decode_base64_block_sse2(src + src_offset, dst))
+					break;	// The scalar loop below reports the error
+
+				dst += 12;
+			}
+#endif
+
+			for (; src_offset < num_full_chars; src_offset += 4)
+			{
+				const uint8_t value0 = get_base64_value(src[src_offset + 0]);
+				const uint8_t value1 = get_base64_value(src[src_offset + 1]);
+				const uint8_t value2 = get_base64_value(src[src_offset + 2]);
+				const uint8_t value3 = get_base64_value(src[src_offset + 3]);
+
+				if ((value0 | value1 | value2 | value3) & 0x80)
+					return false;
+
+				const uint32_t bits = (uint32_t(value0) << 18) | (uint32_t(value1) << 12) | (uint32_t(value2) << 6) | uint32_t(value3);
+				dst[0] = static_cast<uint8_t>(bits >> 16);
+				dst[1] = static_cast<uint8_t>(bits >> 8);
+				dst[2] = static_cast<uint8_t>(bits);
+				dst += 3;
+			}
+
+			// Last group
+			const size_t num_remaining = dst_size - num_full_groups * 3;
+			const char* last_group = src + src_offset;
+
+			const uint8_t value0 = get_base64_value(last_group[0]);
+			const uint8_t value1 = get_base64_value(last_group[1]);
+			const uint8_t value2 = num_remaining >= 2 ? get_base64_value(last_group[2]) : (last_group[2] == '=' ? 0 : 0xFF);
+			const uint8_t value3 = num_remaining == 3 ? get_base64_value(last_group[3]) : (last_group[3] == '=' ? 0 : 0xFF);
+
+			if ((value0 | value1 | value2 | value3) & 0x80)
+				return false;
+
+			const uint32_t bits = (uint32_t(value0) << 18) | (uint32_t(value1) << 12) | (uint32_t(value2) << 6) | uint32_t(value3);
+			dst[0] = static_cast<uint8_t>(bits >> 16);
+			if (num_remaining >= 2)
+				dst[1] = static_cast<uint8_t>(bits >> 8);
+			if (num_remaining == 3)
+				dst[2] = static_cast<uint8_t>(bits);
+
+			return true;
+		}
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/version.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Binary SJSON layout, everything is stored in native endianness:
+		//    - BinaryHeader
+		//    - String table: every entry is a uint32_t length followed by the
+		//      unescaped characters and a NULL terminator
+		//    - Nodes: a BinaryNodeType byte followed by its payload, unaligned
+		//
+		// The root object is implicit, its members directly follow each other.
+		// Keys and strings refer to their entry with a uint32_t offset in the string table.
+		// Numbers are stored as int64_t, uint64_t, or double depending on how they were written.
+		// Objects and arrays end with a matching end node.
+		//////////////////////////////////////////////////////////////////////////
+
+		// 'SJSB' in memory, a document from a platform with a different endianness is rejected
+		constexpr uint32_t k_binary_tag = 0x42534A53;
+
+		// Must be incremented whenever the layout changes
+		constexpr uint32_t k_binary_version = 1;
+
+		struct BinaryHeader
+		{
+			uint32_t tag;
+			uint32_t version;
+			uint32_t string_table_size;
+			uint32_t nodes_size;
+		};
+
+		enum class BinaryNodeType : uint8_t
+		{
+			Key,				// uint32_t string offset
+			Null,
+			False,
+			True,
+			Integer,			// int64_t
+			UnsignedInteger,	// uint64_t, only for values that do not fit in an int64_t
+			Double,				// double
+			String,				// uint32_t string offset
+			ObjectBegins,
+			ObjectEnds,
+			ArrayBegins,
+			ArrayEnds,
+		};
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
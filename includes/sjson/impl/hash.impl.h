@@ -0,0 +1,118 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/version.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// 64 bit MurmurHash2 (MurmurHash64A), it consumes 8 bytes per iteration.
+		// It is not a cryptographic hash, it is only meant to detect content changes.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint64_t hash_bytes(const void* data, size_t size, uint64_t seed = 0)
+		{
+			constexpr uint64_t k_multiplier = 0xC6A4A7935BD1E995ULL;
+			constexpr int k_shift = 47;
+
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			uint64_t hash = seed ^ (uint64_t(size) * k_multiplier);
+
+			const size_t num_blocks = size / 8;
+			for (size_t block_index = 0; block_index < num_blocks; ++block_index)
+			{
+				uint64_t block;
+				std::memcpy(&block, bytes + block_index * 8, sizeof(block));
+
+				block *= k_multiplier;
+				block ^= block >> k_shift;
+				block *= k_multiplier;
+
+				hash ^= block;
+				hash *= k_multiplier;
+			}
+
+			const uint8_t* tail = bytes + num_blocks * 8;
+			const size_t tail_size = size & 7;
+			if (tail_size != 0)
+			{
+				uint64_t block = 0;
+				for (size_t offset = tail_size; offset > 0; --offset)
+					block = (block << 8) | tail[offset - 1];
+
+				hash ^= block;
+				hash *= k_multiplier;
+			}
+
+			hash ^= hash >> k_shift;
+			hash *= k_multiplier;
+			hash ^= hash >> k_shift;
+			return hash;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// 32 bit FNV-1a, used to match keys. It consumes a single character per step
+		// which lets the parser hash keys while it scans them, and it can be evaluated
+		// at compile time for string literals.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr uint32_t k_key_hash_seed = 2166136261U;
+
+		constexpr uint32_t hash_key_step(uint32_t hash, char symbol)
+		{
+			return (hash ^ uint32_t(uint8_t(symbol))) * 16777619U;
+		}
+
+		constexpr uint32_t hash_key(const char* str, size_t length, uint32_t hash = k_key_hash_seed)
+		{
+			return length == 0 ? hash : hash_key(str + 1, length - 1, hash_key_step(hash, *str));
+		}
+
+		// Same as hash_key but iterative, for keys only known at runtime
+		inline uint32_t hash_key_runtime(const char* str, size_t length)
+		{
+			uint32_t hash = k_key_hash_seed;
+			for (size_t offset = 0; offset < length; ++offset)
+				hash = hash_key_step(hash, str[offset]);
+
+			return hash;
+		}
+
+		// Length of a string stored in a character array, up to the first null terminator
+		constexpr size_t key_length(const char* str, size_t max_length)
+		{
+			return max_length == 0 || *str == '\0' ? 0 : 1 + key_length(str + 1, max_length - 1);
+		}
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
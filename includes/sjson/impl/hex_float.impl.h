@@ -0,0 +1,274 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/version.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Hexadecimal floating point values follow the C99 format: [-]0x1.8p+3
+		// Every finite double has an exact representation and conversion only requires
+		// bit manipulation. This makes them much cheaper to read and write than decimal values.
+		//////////////////////////////////////////////////////////////////////////
+
+		// The longest value is: -0x1.fffffffffffffp-1022
+		constexpr size_t k_max_hex_double_length = 24;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the finite value in the buffer, which must hold at least k_max_hex_double_length characters,
+		// and returns the number of characters written. No NULL terminator is written.
+		//////////////////////////////////////////////////////////////////////////
+		inline size_t format_hex_double(double value, char* buffer)
+		{
+			const char* hex_digits = "0123456789abcdef";
+
+			uint64_t bits;
+			std::memcpy(&bits, &value, sizeof(double));
+
+			const bool is_negative = (bits >> 63) != 0;
+			const uint32_t biased_exponent = static_cast<uint32_t>(bits >> 52) & 0x7FF;
+			uint64_t mantissa = bits & ((uint64_t(1) << 52) - 1);
+
+			size_t length = 0;
+			if (is_negative)
+				buffer[length++] = '-';
+
+			buffer[length++] = '0';
+			buffer[length++] = 'x';
+
+			int32_t exponent;
+			if (biased_exponent == 0)
+			{
+				// Zero and subnormal values
+				buffer[length++] = '0';
+				exponent = mantissa == 0 ? 0 : -1022;
+			}
+			else
+			{
+				buffer[length++] = '1';
+				exponent = static_cast<int32_t>(biased_exponent) - 1023;
+			}
+
+			if (mantissa != 0)
+			{
+				buffer[length++] = '.';
+
+				// 52 bits of mantissa are 13 hex digits, trailing zeroes are omitted
+				while (mantissa != 0)
+				{
+					buffer[length++] = hex_digits[(mantissa >> 48) & 0xF];
+					mantissa = (mantissa << 4) & ((uint64_t(1) << 52) - 1);
+				}
+			}
+
+			buffer[length++] = 'p';
+			buffer[length++] = exponent < 0 ? '-' : '+';
+
+			uint32_t abs_exponent = static_cast<uint32_t>(exponent < 0 ? -exponent : exponent);
+			char exponent_digits[4];
+			size_t num_exponent_digits = 0;
+			do
+			{
+				exponent_digits[num_exponent_digits++] = static_cast<char>('0' + (abs_exponent % 10));
+				abs_exponent /= 10;
+			} while (abs_exponent != 0);
+
+			while (num_exponent_digits != 0)
+				buffer[length++] = exponent_digits[--num_exponent_digits];
+
+			return length;
+		}
+
+		inline int32_t get_hex_digit_value(char value)
+		{
+			if (value >= '0' && value <= '9')
+				return value - '0';
+			if (value >= 'a' && value <= 'f')
+				return value - 'a' + 10;
+			if (value >= 'A' && value <= 'F')
+				return value - 'A' + 10;
+			return -1;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Parses a hexadecimal floating point value: [-]0x<hex digits>[.<hex digits>][p[+-]<decimal digits>]
+		// The whole string must be consumed for the parsing to succeed.
+		// Values that cannot be represented exactly are rounded to nearest, ties to even.
+		//////////////////////////////////////////////////////////////////////////
+		inline bool parse_hex_double(const char* str, size_t length, double& value)
+		{
+			size_t offset = 0;
+
+			const bool is_negative = offset < length && str[offset] == '-';
+			if (is_negative)
+				offset++;
+
+			if (offset + 2 > length || str[offset] != '0' || (str[offset + 1] != 'x' && str[offset + 1] != 'X'))
+				return false;
+
+			offset += 2;
+
+			// We keep the 60 most significant bits, anything beyond only matters for rounding
+			uint64_t mantissa = 0;
+			int32_t exponent = 0;
+			bool is_inexact = false;
+			bool has_digits = false;
+			bool has_dot = false;
+
+			for (; offset < length; ++offset)
+			{
+				if (str[offset] == '.' && !has_dot)
+				{
+					has_dot = true;
+					continue;
+				}
+
+				const int32_t digit = get_hex_digit_value(str[offset]);
+				if (digit < 0)
+					break;
+
+				has_digits = true;
+
+				if ((mantissa >> 56) == 0)
+				{
+					mantissa = (mantissa << 4) | static_cast<uint64_t>(digit);
+					if (has_dot)
+						exponent -= 4;
+				}
+				else
+				{
+					is_inexact |= digit != 0;
+					if (!has_dot)
+						exponent += 4;
+				}
+			}
+
+			if (!has_digits)
+				return false;
+
+			if (offset < length && (str[offset] == 'p' || str[offset] == 'P'))
+			{
+				offset++;
+
+				const bool is_exponent_negative = offset < length && str[offset] == '-';
+				if (offset < length && (str[offset] == '-' || str[offset] == '+'))
+					offset++;
+
+				if (offset >= length)
+					return false;
+
+				int32_t exponent_value = 0;
+				for (; offset < length; ++offset)
+				{
+					if (str[offset] < '0' || str[offset] > '9')
+						return false;
+
+					// Saturate, anything this large overflows or underflows anyway
+					if (exponent_value < 100000)
+						exponent_value = exponent_value * 10 + (str[offset] - '0');
+				}
+
+				exponent += is_exponent_negative ? -exponent_value : exponent_value;
+			}
+
+			if (offset != length)
+				return false;
+
+			const uint64_t sign_bit = is_negative ? (uint64_t(1) << 63) : 0;
+			uint64_t bits;
+
+			if (mantissa == 0)
+			{
+				bits = sign_bit;
+			}
+			else
+			{
+				int32_t msb_index = 63;
+				while ((mantissa >> msb_index) == 0)
+					msb_index--;
+
+				// Normal values have 53 significant bits, subnormal values have less
+				const int32_t unbiased_exponent = msb_index + exponent;
+				const int32_t shift = unbiased_exponent >= -1022 ? (msb_index - 52) : -(exponent + 1074);
+
+				if (shift > 0)
+				{
+					if (shift >= 64)
+					{
+						is_inexact |= mantissa != 0;
+						mantissa = 0;
+					}
+					else
+					{
+						const uint64_t remainder = mantissa & ((uint64_t(1) << shift) - 1);
+						const uint64_t half = uint64_t(1) << (shift - 1);
+						mantissa >>= shift;
+
+						if (remainder > half || (remainder == half && (is_inexact || (mantissa & 1) != 0)))
+							mantissa++;
+					}
+				}
+				else
+					mantissa <<= -shift;
+
+				if (unbiased_exponent >= -1022)
+				{
+					// Rounding can carry into the next power of two
+					int32_t biased_exponent = unbiased_exponent + 1023;
+					if ((mantissa >> 53) != 0)
+					{
+						mantissa >>= 1;
+						biased_exponent++;
+					}
+
+					if (biased_exponent >= 0x7FF)
+						bits = sign_bit | (uint64_t(0x7FF) << 52);
+					else
+						bits = sign_bit | (uint64_t(biased_exponent) << 52) | (mantissa & ((uint64_t(1) << 52) - 1));
+				}
+				else
+				{
+					// Subnormal values that round up to the smallest normal value set the exponent bit naturally
+					bits = sign_bit | mantissa;
+				}
+			}
+
+			std::memcpy(&value, &bits, sizeof(double));
+			return true;
+		}
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
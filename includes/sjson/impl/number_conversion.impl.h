@@ -0,0 +1,160 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/version.h"
+#include "sjson/impl/simd.impl.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		// Numbers converted on ingest are parsed in chunks of this size, a full precision copy of the array is never needed
+		constexpr uint32_t k_conversion_chunk_size = 16;
+
+		// Converts to an IEEE 754 half float, rounding to nearest even
+		inline uint16_t float_to_half(float value)
+		{
+			uint32_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+
+			const uint32_t sign = (bits >> 16) & 0x8000;
+			const uint32_t abs_bits = bits & 0x7FFFFFFF;
+
+			if (abs_bits >= 0x7F800000)
+				return uint16_t(sign | 0x7C00 | (abs_bits > 0x7F800000 ? 0x0200 : 0));	// Infinity or NaN
+
+			if (abs_bits >= 0x477FF000)
+				return uint16_t(sign | 0x7C00);		// Rounds past the largest half, 65504
+
+			if (abs_bits < 0x38800000)
+			{
+				// Below the smallest normal half, 2^-14
+				if (abs_bits <= 0x33000000)
+					return uint16_t(sign);			// At most half of the smallest denormal, 2^-25
+
+				const uint32_t exponent = abs_bits >> 23;
+				const uint32_t mantissa = (abs_bits & 0x007FFFFF) | 0x00800000;
+				const uint32_t shift = 126 - exponent;
+				const uint32_t remainder = mantissa & ((1U << shift) - 1);
+				const uint32_t halfway = 1U << (shift - 1);
+
+				uint32_t half = mantissa >> shift;
+				if (remainder > halfway || (remainder == halfway && (half & 1) != 0))
+					half++;
+
+				return uint16_t(sign | half);
+			}
+
+			// Rebias the exponent, a mantissa that rounds up carries into the exponent
+			uint32_t half = (abs_bits - 0x38000000) >> 13;
+			const uint32_t remainder = abs_bits & 0x1FFF;
+			if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1) != 0))
+				half++;
+
+			return uint16_t(sign | half);
+		}
+
+		inline void convert_to_half(const float* input, uint16_t* output, uint32_t count)
+		{
+			uint32_t index = 0;
+
+#if defined(SJSON_CPP_IMPL_F16C_INTRINSICS)
+			for (; index + 4 <= count; index += 4)
+			{
+				const __m128i halves = _mm_cvtps_ph(_mm_loadu_ps(input + index), _MM_FROUND_TO_NEAREST_INT);
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(output + index), halves);
+			}
+#elif defined(SJSON_CPP_IMPL_NEON64_INTRINSICS)
+			for (; index + 4 <= count; index += 4)
+				vst1_u16(output + index, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(input + index))));
+#endif
+
+			for (; index < count; ++index)
+				output[index] = float_to_half(input[index]);
+		}
+
+		// Signed integers map [-1.0, 1.0] to [-max, max] and unsigned integers map [0.0, 1.0] to [0, max],
+		// values outside the range are clamped and the result is rounded to nearest even
+		template<typename IntegerType>
+		inline void convert_to_normalized(const float* input, IntegerType* output, uint32_t count)
+		{
+			static_assert(std::is_integral<IntegerType>::value && !std::is_same<IntegerType, bool>::value && sizeof(IntegerType) <= 2, "Normalized values must be 8 or 16 bit integers");
+
+			const float min_value = std::is_signed<IntegerType>::value ? -1.0F : 0.0F;
+			const float scale = float(std::numeric_limits<IntegerType>::max());
+
+			uint32_t index = 0;
+
+#if defined(SJSON_CPP_IMPL_SSE2_INTRINSICS)
+			const __m128 min_value4 = _mm_set1_ps(min_value);
+			const __m128 max_value4 = _mm_set1_ps(1.0F);
+			const __m128 scale4 = _mm_set1_ps(scale);
+
+			for (; index + 4 <= count; index += 4)
+			{
+				const __m128 clamped = _mm_max_ps(_mm_min_ps(_mm_loadu_ps(input + index), max_value4), min_value4);
+
+				int32_t lanes[4];
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_cvtps_epi32(_mm_mul_ps(clamped, scale4)));
+
+				for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+					output[index + lane_index] = IntegerType(lanes[lane_index]);
+			}
+#elif defined(SJSON_CPP_IMPL_NEON64_INTRINSICS)
+			const float32x4_t min_value4 = vdupq_n_f32(min_value);
+			const float32x4_t max_value4 = vdupq_n_f32(1.0F);
+
+			for (; index + 4 <= count; index += 4)
+			{
+				const float32x4_t clamped = vmaxq_f32(vminq_f32(vld1q_f32(input + index), max_value4), min_value4);
+
+				int32_t lanes[4];
+				vst1q_s32(lanes, vcvtnq_s32_f32(vmulq_n_f32(clamped, scale)));
+
+				for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+					output[index + lane_index] = IntegerType(lanes[lane_index]);
+			}
+#endif
+
+			for (; index < count; ++index)
+			{
+				const float clamped = std::max(std::min(input[index], 1.0F), min_value);
+				output[index] = IntegerType(std::nearbyint(clamped * scale));
+			}
+		}
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
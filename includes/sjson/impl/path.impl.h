@@ -0,0 +1,148 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/string_view.h"
+#include "sjson/version.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		enum class PathSegmentType : uint8_t
+		{
+			Key,
+			AnyKey,
+			Element,
+			AnyElement,
+		};
+
+		// A step from a container to one of its values: a key or an array element index, or any of them
+		struct PathSegment
+		{
+			StringView key;
+			size_t index;
+			PathSegmentType type;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Compiles a path pattern into segments once, so values can be matched without scanning it again.
+		// Patterns are keys separated by dots with array elements between brackets,
+		// a '*' matches any key or any element, e.g.: clip.tracks[*].name or settings.*
+		// Keys that contain a dot, a bracket, or that are a single '*' cannot be matched literally.
+		// Keys point into the pattern which must outlive the segments.
+		// Returns the number of segments, or 0 if the pattern is malformed or has more than max_num_segments.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t compile_path(const char* pattern, PathSegment* segments, uint32_t max_num_segments)
+		{
+			uint32_t num_segments = 0;
+
+			while (*pattern != '\0')
+			{
+				if (num_segments == max_num_segments)
+					return 0;
+
+				PathSegment& segment = segments[num_segments];
+				segment.index = 0;
+
+				if (*pattern == '[')
+				{
+					pattern++;
+
+					if (*pattern == '*')
+					{
+						segment.type = PathSegmentType::AnyElement;
+						pattern++;
+					}
+					else
+					{
+						const char* digits = pattern;
+						while (*pattern >= '0' && *pattern <= '9')
+						{
+							if (segment.index > (~size_t(0) - 9) / 10)
+								return 0;	// The index would overflow
+
+							segment.index = segment.index * 10 + size_t(*pattern++ - '0');
+						}
+
+						if (pattern == digits)
+							return 0;
+
+						segment.type = PathSegmentType::Element;
+					}
+
+					if (*pattern != ']')
+						return 0;
+
+					pattern++;
+				}
+				else
+				{
+					if (num_segments != 0)
+					{
+						if (*pattern != '.')
+							return 0;
+
+						pattern++;
+					}
+
+					const char* key = pattern;
+					while (*pattern != '\0' && *pattern != '.' && *pattern != '[')
+						pattern++;
+
+					segment.key = StringView(key, size_t(pattern - key));
+					if (segment.key.size() == 0)
+						return 0;
+
+					segment.type = segment.key == "*" ? PathSegmentType::AnyKey : PathSegmentType::Key;
+				}
+
+				num_segments++;
+			}
+
+			return num_segments;
+		}
+
+		// Matches a segment against the step to a value, the key is nullptr for array elements
+		inline bool match_path_segment(const PathSegment& segment, const StringView* key, size_t index)
+		{
+			switch (segment.type)
+			{
+			case PathSegmentType::Key:			return key != nullptr && segment.key == *key;
+			case PathSegmentType::AnyKey:		return key != nullptr;
+			case PathSegmentType::Element:		return key == nullptr && segment.index == index;
+			case PathSegmentType::AnyElement:
+			default:							return key == nullptr;
+			}
+		}
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
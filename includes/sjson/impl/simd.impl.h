@@ -0,0 +1,85 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/version.h"
+
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////
+// SIMD intrinsics are used opportunistically where the target guarantees their
+// availability and a scalar fallback is always provided.
+// To disable them entirely, define SJSON_CPP_NO_INTRINSICS before including
+// any sjson-cpp header.
+//
+// NEON is only used on ARM64 where horizontal reductions are available.
+// F16C is only used when the compiler targets it (e.g. -mf16c or /arch:AVX2).
+//////////////////////////////////////////////////////////////////////////
+
+#if !defined(SJSON_CPP_NO_INTRINSICS)
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define SJSON_CPP_IMPL_SSE2_INTRINSICS
+	#elif defined(__aarch64__) || defined(_M_ARM64)
+		#define SJSON_CPP_IMPL_NEON64_INTRINSICS
+	#endif
+#endif
+
+#if defined(SJSON_CPP_IMPL_SSE2_INTRINSICS) && (defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__)))
+	#define SJSON_CPP_IMPL_F16C_INTRINSICS
+#endif
+
+#if defined(SJSON_CPP_IMPL_F16C_INTRINSICS)
+	#include <immintrin.h>
+#elif defined(SJSON_CPP_IMPL_SSE2_INTRINSICS)
+	#include <emmintrin.h>
+#elif defined(SJSON_CPP_IMPL_NEON64_INTRINSICS)
+	#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		// Returns the index of the least significant bit set, the input must not be zero
+		inline uint32_t count_trailing_zeros(uint32_t value)
+		{
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward(&index, value);
+			return static_cast<uint32_t>(index);
+#else
+			return static_cast<uint32_t>(__builtin_ctz(value));
+#endif
+		}
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
@@ -0,0 +1,390 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/version.h"
+#include "sjson/impl/hex_float.impl.h"
+#include "sjson/impl/simd.impl.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if the character cannot appear as-is within a quoted string:
+		// quotation marks, backslashes, and control characters.
+		//////////////////////////////////////////////////////////////////////////
+		inline bool is_character_to_escape(char value)
+		{
+			return static_cast<unsigned char>(value) < 0x20 || value == '"' || value == '\\';
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the offset of the first character that needs to be escaped or
+		// the string length if there are none. Strings are scanned 16 bytes at a time
+		// when SIMD is available, most strings have nothing to escape.
+		//////////////////////////////////////////////////////////////////////////
+		inline size_t find_first_character_to_escape(const char* str, size_t length)
+		{
+			size_t offset = 0;
+
+#if defined(SJSON_CPP_IMPL_SSE2_INTRINSICS)
+			const __m128i quotation_mark = _mm_set1_epi8('"');
+			const __m128i backslash = _mm_set1_epi8('\\');
+			const __m128i last_control_character = _mm_set1_epi8(0x1F);
+
+			for (; offset + 16 <= length; offset += 16)
+			{
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + offset));
+				const __m128i is_quotation_mark = _mm_cmpeq_epi8(chunk, quotation_mark);
+				const __m128i is_backslash = _mm_cmpeq_epi8(chunk, backslash);
+				const __m128i is_control_character = _mm_cmpeq_epi8(_mm_min_epu8(chunk, last_control_character), chunk);
+
+				const int mask = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(is_quotation_mark, is_backslash), is_control_character));
+				if (mask != 0)
+					return offset + count_trailing_zeros(static_cast<uint32_t>(mask));
+			}
+#elif defined(SJSON_CPP_IMPL_NEON64_INTRINSICS)
+			const uint8x16_t quotation_mark = vdupq_n_u8('"');
+			const uint8x16_t backslash = vdupq_n_u8('\\');
+			const uint8x16_t first_printable_character = vdupq_n_u8(0x20);
+
+			for (; offset + 16 <= length; offset += 16)
+			{
+				const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(str + offset));
+				const uint8x16_t is_quotation_mark = vceqq_u8(chunk, quotation_mark);
+				const uint8x16_t is_backslash = vceqq_u8(chunk, backslash);
+				const uint8x16_t is_control_character = vcltq_u8(chunk, first_printable_character);
+
+				if (vmaxvq_u8(vorrq_u8(vorrq_u8(is_quotation_mark, is_backslash), is_control_character)) != 0)
+					break;	// The scalar loop below finds the exact offset within this chunk
+			}
+#endif
+
+			for (; offset < length; ++offset)
+			{
+				if (is_character_to_escape(str[offset]))
+					return offset;
+			}
+
+			return length;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the escape sequence for the provided character in the buffer and returns its length.
+		// The buffer must be able to hold at least 6 characters.
+		//////////////////////////////////////////////////////////////////////////
+		inline size_t get_escape_sequence(char value, char* buffer)
+		{
+			buffer[0] = '\\';
+
+			switch (value)
+			{
+			case '"':	buffer[1] = '"'; return 2;
+			case '\\':	buffer[1] = '\\'; return 2;
+			case '\b':	buffer[1] = 'b'; return 2;
+			case '\f':	buffer[1] = 'f'; return 2;
+			case '\n':	buffer[1] = 'n'; return 2;
+			case '\r':	buffer[1] = 'r'; return 2;
+			case '\t':	buffer[1] = 't'; return 2;
+			default:
+			{
+				const char* hex_digits = "0123456789abcdef";
+				const uint8_t code = static_cast<uint8_t>(value);
+
+				buffer[1] = 'u';
+				buffer[2] = '0';
+				buffer[3] = '0';
+				buffer[4] = hex_digits[code >> 4];
+				buffer[5] = hex_digits[code & 0x0F];
+				return 6;
+			}
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if a key must be written between quotation marks to be read back:
+		// empty keys, keys that contain whitespace, an equal sign, a quotation mark or a backslash,
+		// and keys that would start like a comment.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool is_key_character_requiring_quotes(char value)
+		{
+			return static_cast<unsigned char>(value) <= ' ' || value == '=' || value == '"' || value == '\\';
+		}
+
+		constexpr bool is_key_suffix_requiring_quotes(const char* key, size_t length, size_t offset)
+		{
+			return offset < length && (is_key_character_requiring_quotes(key[offset]) || is_key_suffix_requiring_quotes(key, length, offset + 1));
+		}
+
+		// Usable in constant expressions for string literals
+		constexpr bool is_constexpr_key_requiring_quotes(const char* key, size_t length)
+		{
+			return length == 0 || key[0] == '/' || is_key_suffix_requiring_quotes(key, length, 0);
+		}
+
+		inline bool is_key_requiring_quotes(const char* key, size_t length)
+		{
+			if (length == 0 || key[0] == '/')
+				return true;
+
+			for (size_t offset = 0; offset < length; ++offset)
+			{
+				if (is_key_character_requiring_quotes(key[offset]))
+					return true;
+			}
+
+			return false;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the offset of the first backslash or the string length if there are none.
+		// Strings are scanned 16 bytes at a time when SIMD is available.
+		//////////////////////////////////////////////////////////////////////////
+		inline size_t find_first_backslash(const char* str, size_t length)
+		{
+			size_t offset = 0;
+
+#if defined(SJSON_CPP_IMPL_SSE2_INTRINSICS)
+			const __m128i backslash = _mm_set1_epi8('\\');
+
+			for (; offset + 16 <= length; offset += 16)
+			{
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + offset));
+				const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, backslash));
+				if (mask != 0)
+					return offset + count_trailing_zeros(static_cast<uint32_t>(mask));
+			}
+#elif defined(SJSON_CPP_IMPL_NEON64_INTRINSICS)
+			const uint8x16_t backslash = vdupq_n_u8('\\');
+
+			for (; offset + 16 <= length; offset += 16)
+			{
+				const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(str + offset));
+				if (vmaxvq_u8(vceqq_u8(chunk, backslash)) != 0)
+					break;	// The scalar loop below finds the exact offset within this chunk
+			}
+#endif
+
+			for (; offset < length; ++offset)
+			{
+				if (str[offset] == '\\')
+					return offset;
+			}
+
+			return length;
+		}
+
+		// Parses the 4 hex digits of a \uXXXX escape sequence, returns -1 if they are invalid
+		inline int32_t parse_unicode_escape_sequence(const char* str, size_t length, size_t offset)
+		{
+			if (offset + 6 > length || str[offset] != '\\' || str[offset + 1] != 'u')
+				return -1;
+
+			int32_t code_point = 0;
+			for (size_t digit_offset = offset + 2; digit_offset < offset + 6; ++digit_offset)
+			{
+				const int32_t digit = get_hex_digit_value(str[digit_offset]);
+				if (digit < 0)
+					return -1;
+
+				code_point = (code_point << 4) | digit;
+			}
+
+			return code_point;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decodes the escape sequence that starts with the backslash at the provided offset
+		// and returns the number of input characters it spans.
+		// Unicode escape sequences are encoded as UTF-8 and surrogate pairs are combined.
+		// Sequences that cannot be decoded are kept as-is: unknown escapes, lone surrogates,
+		// and \u0000 since a StringView cannot hold NULL terminators. Only the backslash is
+		// decoded and what follows it is handled as regular characters.
+		//////////////////////////////////////////////////////////////////////////
+		inline size_t decode_escape_sequence(const char* str, size_t length, size_t offset, char (&decoded)[4], size_t& decoded_length)
+		{
+			decoded[0] = str[offset];
+			decoded_length = 1;
+
+			if (offset + 1 >= length)
+				return 1;
+
+			char unescaped_symbol = '\0';
+			switch (str[offset + 1])
+			{
+			case '"':	unescaped_symbol = '"'; break;
+			case '\\':	unescaped_symbol = '\\'; break;
+			case '/':	unescaped_symbol = '/'; break;
+			case 'b':	unescaped_symbol = '\b'; break;
+			case 'f':	unescaped_symbol = '\f'; break;
+			case 'n':	unescaped_symbol = '\n'; break;
+			case 'r':	unescaped_symbol = '\r'; break;
+			case 't':	unescaped_symbol = '\t'; break;
+			default:	break;
+			}
+
+			if (unescaped_symbol != '\0')
+			{
+				decoded[0] = unescaped_symbol;
+				return 2;
+			}
+
+			uint32_t code_point = 0;
+			size_t sequence_length = 0;
+
+			const int32_t code_unit = parse_unicode_escape_sequence(str, length, offset);
+			if (code_unit > 0 && (code_unit < 0xD800 || code_unit > 0xDFFF))
+			{
+				code_point = static_cast<uint32_t>(code_unit);
+				sequence_length = 6;
+			}
+			else if (code_unit >= 0xD800 && code_unit <= 0xDBFF)
+			{
+				const int32_t low_code_unit = parse_unicode_escape_sequence(str, length, offset + 6);
+				if (low_code_unit >= 0xDC00 && low_code_unit <= 0xDFFF)
+				{
+					code_point = 0x10000 + ((static_cast<uint32_t>(code_unit) - 0xD800) << 10) + (static_cast<uint32_t>(low_code_unit) - 0xDC00);
+					sequence_length = 12;
+				}
+			}
+
+			if (sequence_length == 0)
+				return 1;	// Cannot be decoded, keep the backslash
+
+			if (code_point < 0x80)
+			{
+				decoded[0] = static_cast<char>(code_point);
+				decoded_length = 1;
+			}
+			else if (code_point < 0x800)
+			{
+				decoded[0] = static_cast<char>(0xC0 | (code_point >> 6));
+				decoded[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+				decoded_length = 2;
+			}
+			else if (code_point < 0x10000)
+			{
+				decoded[0] = static_cast<char>(0xE0 | (code_point >> 12));
+				decoded[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+				decoded[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+				decoded_length = 3;
+			}
+			else
+			{
+				decoded[0] = static_cast<char>(0xF0 | (code_point >> 18));
+				decoded[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+				decoded[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+				decoded[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+				decoded_length = 4;
+			}
+
+			return sequence_length;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Replaces escape sequences by the characters they represent and returns the resulting length,
+		// see decode_escape_sequence.
+		// The output is never longer than the input which allows unescaping in place.
+		// When the output is nullptr, only the resulting length is computed.
+		// Characters between escape sequences are found with SIMD and copied in bulk.
+		//////////////////////////////////////////////////////////////////////////
+		inline size_t unescape_string(const char* str, size_t length, char* output)
+		{
+			size_t output_length = 0;
+			size_t offset = 0;
+
+			while (offset < length)
+			{
+				const size_t clean_length = find_first_backslash(str + offset, length - offset);
+				if (clean_length != 0)
+				{
+					// The output can overlap the input when unescaping in place
+					if (output != nullptr)
+						std::memmove(output + output_length, str + offset, clean_length);
+
+					output_length += clean_length;
+					offset += clean_length;
+
+					if (offset == length)
+						break;
+				}
+
+				char decoded[4];
+				size_t decoded_length;
+				offset += decode_escape_sequence(str, length, offset, decoded, decoded_length);
+
+				if (output != nullptr)
+					std::memcpy(output + output_length, decoded, decoded_length);
+
+				output_length += decoded_length;
+			}
+
+			return output_length;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if the escaped string is equal to the provided string once unescaped.
+		// Escape sequences are decoded one at a time, nothing is unescaped in a buffer.
+		//////////////////////////////////////////////////////////////////////////
+		inline bool is_unescaped_string_equal(const char* str, size_t length, const char* other, size_t other_length)
+		{
+			size_t offset = 0;
+			size_t other_offset = 0;
+
+			while (offset < length)
+			{
+				const size_t clean_length = find_first_backslash(str + offset, length - offset);
+				if (clean_length > other_length - other_offset || std::memcmp(str + offset, other + other_offset, clean_length) != 0)
+					return false;
+
+				offset += clean_length;
+				other_offset += clean_length;
+
+				if (offset == length)
+					break;
+
+				char decoded[4];
+				size_t decoded_length;
+				offset += decode_escape_sequence(str, length, offset, decoded, decoded_length);
+
+				if (decoded_length > other_length - other_offset || std::memcmp(decoded, other + other_offset, decoded_length) != 0)
+					return false;
+
+				other_offset += decoded_length;
+			}
+
+			return other_offset == other_length;
+		}
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/version.h"
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		// Whitespace between tokens, shared by the Parser and everything that scans SJSON without one
+		inline bool is_whitespace(char value)
+		{
+			return std::isspace(static_cast<unsigned char>(value)) != 0;
+		}
+
+		// Returned when an offset is not at the start or at the end of its line
+		constexpr size_t k_invalid_offset = ~size_t(0);
+
+		// Returns the offset at which the line begins if only spaces and tabs precede the provided offset on it
+		inline size_t find_line_start(const char* input, size_t offset)
+		{
+			while (offset > 0 && (input[offset - 1] == ' ' || input[offset - 1] == '\t'))
+				offset--;
+
+			if (offset != 0 && input[offset - 1] != '\n')
+				return k_invalid_offset;
+
+			return offset;
+		}
+
+		// Returns the offset past the line terminator if only spaces, tabs, and a // comment follow the provided offset on its line
+		inline size_t find_line_end(const char* input, size_t input_length, size_t offset)
+		{
+			while (offset < input_length && (input[offset] == ' ' || input[offset] == '\t' || input[offset] == '\r'))
+				offset++;
+
+			if (offset + 1 < input_length && input[offset] == '/' && input[offset + 1] == '/')
+			{
+				while (offset < input_length && input[offset] != '\n')
+					offset++;
+			}
+
+			if (offset == input_length)
+				return offset;
+
+			if (input[offset] != '\n')
+				return k_invalid_offset;
+
+			return offset + 1;
+		}
+
+		// Returns the number of tabs that indent the line on which the provided offset lies
+		inline uint32_t get_indent_level(const char* input, size_t input_length, size_t offset)
+		{
+			while (offset > 0 && input[offset - 1] != '\n')
+				offset--;
+
+			uint32_t indent_level = 0;
+			while (offset + indent_level < input_length && input[offset + indent_level] == '\t')
+				indent_level++;
+
+			return indent_level;
+		}
+
+		// Returns the line and column of the provided offset with the convention of the Parser:
+		// both start at 1 and a line feed is the first column of the line it begins.
+		// Offsets past the end of the input report the position of the end of the input.
+		inline void get_line_and_column(const char* input, size_t input_length, size_t offset, uint32_t& line, uint32_t& column)
+		{
+			line = 1;
+			column = 1;
+
+			for (size_t input_offset = 1; input_offset <= offset && input_offset < input_length; ++input_offset)
+			{
+				if (input[input_offset] == '\n')
+				{
+					line++;
+					column = 1;
+				}
+				else
+					column++;
+			}
+		}
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
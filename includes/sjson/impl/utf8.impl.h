@@ -0,0 +1,95 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/version.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the length of the well-formed UTF-8 sequence that begins at the provided offset
+		// or 0 if it is malformed or truncated. Overlong encodings, surrogates,
+		// and code points past U+10FFFF are rejected.
+		// Meant to be called while scanning a string, only for bytes outside the ASCII range.
+		//////////////////////////////////////////////////////////////////////////
+		inline size_t get_utf8_sequence_length(const char* str, size_t length, size_t offset)
+		{
+			const uint8_t* bytes = reinterpret_cast<const uint8_t*>(str);
+			const uint8_t lead = bytes[offset];
+			if (lead < 0x80)
+				return 1;
+
+			size_t sequence_length;
+			uint8_t min_second = 0x80;
+			uint8_t max_second = 0xBF;
+
+			if (lead >= 0xC2 && lead <= 0xDF)
+			{
+				sequence_length = 2;
+			}
+			else if (lead >= 0xE0 && lead <= 0xEF)
+			{
+				sequence_length = 3;
+				if (lead == 0xE0)
+					min_second = 0xA0;		// Overlong
+				else if (lead == 0xED)
+					max_second = 0x9F;		// Surrogates
+			}
+			else if (lead >= 0xF0 && lead <= 0xF4)
+			{
+				sequence_length = 4;
+				if (lead == 0xF0)
+					min_second = 0x90;		// Overlong
+				else if (lead == 0xF4)
+					max_second = 0x8F;		// Past U+10FFFF
+			}
+			else
+				return 0;
+
+			if (offset + sequence_length > length)
+				return 0;
+
+			if (bytes[offset + 1] < min_second || bytes[offset + 1] > max_second)
+				return 0;
+
+			for (size_t continuation_offset = 2; continuation_offset < sequence_length; ++continuation_offset)
+			{
+				if ((bytes[offset + continuation_offset] & 0xC0) != 0x80)
+					return 0;
+			}
+
+			return sequence_length;
+		}
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
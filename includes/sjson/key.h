@@ -0,0 +1,131 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/string_view.h"
+#include "sjson/version.h"
+#include "sjson/impl/hash.impl.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// A Key is the name of a member along with its length and hash. Keys built from string
+	// literals are computed at compile time when the Key is constexpr and the parser only
+	// compares the characters of keys that have the same length and hash.
+	// It does NOT own the memory, the string must outlive the Key.
+	//
+	// e.g.:
+	//    constexpr Key k_sample_rate("sample_rate");
+	//    parser.read(k_sample_rate, sample_rate);
+	//
+	// Every parser function that accepts a Key also accepts a string directly.
+	//////////////////////////////////////////////////////////////////////////
+	class Key
+	{
+	public:
+		template<size_t N>
+		constexpr Key(const char (&str)[N])
+			: m_c_str(str)
+			, m_length(sjson_impl::key_length(str, N - 1))
+			, m_hash(sjson_impl::hash_key(str, sjson_impl::key_length(str, N - 1)))
+		{}
+
+		// Only selected for pointers, arrays use the constructor above
+		template<typename CharPtrType, typename std::enable_if<std::is_same<CharPtrType, const char*>::value || std::is_same<CharPtrType, char*>::value>::type* = nullptr>
+		Key(CharPtrType str)
+			: m_c_str(str)
+			, m_length(std::strlen(str))
+			, m_hash(sjson_impl::hash_key_runtime(str, m_length))
+		{}
+
+		Key(const char* str, size_t length)
+			: m_c_str(str)
+			, m_length(length)
+			, m_hash(sjson_impl::hash_key_runtime(str, length))
+		{}
+
+		constexpr const char* c_str() const { return m_c_str; }
+		constexpr size_t size() const { return m_length; }
+		constexpr uint32_t get_hash() const { return m_hash; }
+
+		bool operator==(const StringView& other) const
+		{
+			return m_length == other.size() && std::memcmp(m_c_str, other.c_str(), m_length) == 0;
+		}
+
+		bool operator!=(const StringView& other) const { return !(*this == other); }
+
+	private:
+		const char* m_c_str;
+		size_t m_length;
+		uint32_t m_hash;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Maps a string value to an enum value, see Parser::read_enum.
+	// Tables are meant to be constexpr so that the length and hash of every name
+	// are computed at compile time.
+	//
+	// e.g.:
+	//    constexpr EnumEntry<TrackType> k_track_types[] = { { "rotation", TrackType::Rotation }, { "translation", TrackType::Translation } };
+	//////////////////////////////////////////////////////////////////////////
+	template<typename EnumType>
+	struct EnumEntry
+	{
+		Key name;
+		EnumType value;
+	};
+
+	namespace sjson_impl
+	{
+		// Entries are matched on their length and hash first, only a match is compared character by character
+		template<typename EnumType>
+		inline bool find_enum_value(const StringView& name, const EnumEntry<EnumType>* entries, size_t num_entries, EnumType& value)
+		{
+			const uint32_t hash = hash_key_runtime(name.c_str(), name.size());
+
+			for (size_t entry_index = 0; entry_index < num_entries; ++entry_index)
+			{
+				const EnumEntry<EnumType>& entry = entries[entry_index];
+				if (entry.name.get_hash() == hash && entry.name == name)
+				{
+					value = entry.value;
+					return true;
+				}
+			}
+
+			return false;
+		}
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
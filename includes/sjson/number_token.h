@@ -0,0 +1,152 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/string_view.h"
+#include "sjson/version.h"
+#include "sjson/impl/cstdlib.impl.h"
+#include "sjson/impl/hex_float.impl.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+//////////////////////////////////////////////////////////////////////////
+// Converters for raw number tokens, as returned by Parser::read_number_token or
+// reported by ParseVisitor::on_number. They do not depend on a parser and can be
+// used long after parsing, from any thread.
+// The whole token must be consumed for a conversion to succeed.
+//////////////////////////////////////////////////////////////////////////
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		// Longest decimal token that can be converted, matches the parser
+		constexpr size_t k_max_number_token_length = 64;
+
+		inline bool is_hex_number_token(const StringView& token)
+		{
+			const size_t offset = token.size() != 0 && token.c_str()[0] == '-' ? 1 : 0;
+			return token.size() >= offset + 2 && token.c_str()[offset] == '0' && (token.c_str()[offset + 1] == 'x' || token.c_str()[offset + 1] == 'X');
+		}
+
+		// Copies the token into a null terminated buffer for the C conversion functions
+		inline bool copy_number_token(const StringView& token, char (&slice)[k_max_number_token_length + 1])
+		{
+			if (token.size() == 0 || token.size() >= k_max_number_token_length)
+				return false;
+
+			std::memcpy(slice, token.c_str(), token.size());
+			slice[token.size()] = '\0';
+			return true;
+		}
+	}
+
+	inline bool to_double(const StringView& token, double& value)
+	{
+		if (sjson_impl::is_hex_number_token(token))
+			return sjson_impl::parse_hex_double(token.c_str(), token.size(), value);
+
+		char slice[sjson_impl::k_max_number_token_length + 1];
+		if (!sjson_impl::copy_number_token(token, slice))
+			return false;
+
+		char* last_used_symbol = nullptr;
+		value = std::strtod(slice, &last_used_symbol);
+		return last_used_symbol == slice + token.size();
+	}
+
+	inline bool to_float(const StringView& token, float& value)
+	{
+		if (sjson_impl::is_hex_number_token(token))
+		{
+			double dbl_value;
+			if (!sjson_impl::parse_hex_double(token.c_str(), token.size(), dbl_value))
+				return false;
+
+			value = static_cast<float>(dbl_value);
+			return true;
+		}
+
+		char slice[sjson_impl::k_max_number_token_length + 1];
+		if (!sjson_impl::copy_number_token(token, slice))
+			return false;
+
+		char* last_used_symbol = nullptr;
+		value = sjson_impl::strtof(slice, &last_used_symbol);
+		return last_used_symbol == slice + token.size();
+	}
+
+	// Integers follow the rules of Parser::read: a leading 0x is hexadecimal and a leading 0 is octal.
+	// Fails if the value does not fit in the integral type.
+	template<typename IntegralType>
+	inline bool to_int(const StringView& token, IntegralType& value)
+	{
+		static_assert(std::is_integral<IntegralType>::value, "to_int requires an integral type");
+
+		char slice[sjson_impl::k_max_number_token_length + 1];
+		if (!sjson_impl::copy_number_token(token, slice))
+			return false;
+
+		const size_t offset = slice[0] == '-' ? 1 : 0;
+		int base = 10;
+		if (slice[offset] == '0' && (slice[offset + 1] == 'x' || slice[offset + 1] == 'X'))
+			base = 16;
+		else if (slice[offset] == '0')
+			base = 8;
+
+		// Out of range values saturate, they are detected with errno
+		errno = 0;
+
+		char* last_used_symbol = nullptr;
+		if (std::is_unsigned<IntegralType>::value)
+		{
+			if (offset != 0)
+				return false;
+
+			const uint64_t raw_value = sjson_impl::strtoull(slice, &last_used_symbol, base);
+			value = static_cast<IntegralType>(raw_value);
+
+			if (static_cast<uint64_t>(value) != raw_value)
+				return false;
+		}
+		else
+		{
+			const int64_t raw_value = sjson_impl::strtoll(slice, &last_used_symbol, base);
+			value = static_cast<IntegralType>(raw_value);
+
+			if (static_cast<int64_t>(value) != raw_value)
+				return false;
+		}
+
+		return last_used_symbol == slice + token.size() && errno != ERANGE;
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
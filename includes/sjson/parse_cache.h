@@ -0,0 +1,228 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/version.h"
+#include "sjson/impl/binary_format.impl.h"
+#include "sjson/impl/hash.impl.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// A parse cache stores the binary document compiled from an SJSON input in a
+	// file next to it, keyed by the hash of the input bytes. When the input has not
+	// changed, the binary document is loaded from the cache and nothing is parsed.
+	//
+	// Cache files contain a header followed by the binary document as-is, they can be
+	// read with read_parse_cache or memory mapped and validated with find_cached_document.
+	// A cache file is stale when the input differs, or when it was written by a different
+	// cache or binary version; stale files are treated as misses and can be overwritten.
+	//
+	// Typical usage, compile_binary returns the required size without writing anything
+	// when the buffer is too small, and 0 when the input cannot be parsed:
+	//    const ParseCacheKey key = compute_parse_cache_key(input, input_size);
+	//    size_t document_size = read_parse_cache(cache_path, key, buffer, buffer_size);
+	//    if (document_size == 0)
+	//    {
+	//        Parser parser(input, input_size);
+	//        document_size = compile_binary(parser, buffer, buffer_size);
+	//        if (document_size == 0 || document_size > buffer_size)
+	//            return false;	// Parser error or larger buffer needed
+	//
+	//        write_parse_cache(cache_path, key, buffer, document_size);
+	//    }
+	//    BinaryReader reader(buffer, document_size);
+	//////////////////////////////////////////////////////////////////////////
+	struct ParseCacheKey
+	{
+		uint64_t input_size;
+		uint64_t input_hash;
+	};
+
+	namespace sjson_impl
+	{
+		// 'SJSC' in memory
+		constexpr uint32_t k_parse_cache_tag = 0x43534A53;
+
+		// Must be incremented whenever the cache header changes
+		constexpr uint32_t k_parse_cache_version = 1;
+
+		struct ParseCacheHeader
+		{
+			uint32_t tag;
+			uint32_t version;
+			uint32_t binary_version;
+			uint32_t padding;
+			uint64_t input_size;
+			uint64_t input_hash;
+			uint64_t document_size;
+		};
+
+		inline bool is_parse_cache_header_valid(const ParseCacheHeader& header, const ParseCacheKey& key)
+		{
+			return header.tag == k_parse_cache_tag
+				&& header.version == k_parse_cache_version
+				&& header.binary_version == k_binary_version
+				&& header.input_size == key.input_size
+				&& header.input_hash == key.input_hash;
+		}
+
+		inline std::FILE* open_file(const char* path, const char* mode)
+		{
+#if defined(_MSC_VER)
+			std::FILE* file = nullptr;
+			fopen_s(&file, path, mode);
+			return file;
+#else
+			return std::fopen(path, mode);
+#endif
+		}
+	}
+
+	inline ParseCacheKey compute_parse_cache_key(const char* input, size_t input_size)
+	{
+		ParseCacheKey key;
+		key.input_size = input_size;
+		key.input_hash = sjson_impl::hash_bytes(input, input_size);
+		return key;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Validates the content of a cache file already in memory, e.g. memory mapped.
+	// Returns a pointer to the binary document it contains or nullptr if the cache is stale.
+	//////////////////////////////////////////////////////////////////////////
+	inline const void* find_cached_document(const void* cache_data, size_t cache_size, const ParseCacheKey& key, size_t& out_document_size)
+	{
+		out_document_size = 0;
+
+		sjson_impl::ParseCacheHeader header;
+		if (cache_data == nullptr || cache_size < sizeof(header))
+			return nullptr;
+
+		std::memcpy(&header, cache_data, sizeof(header));
+		if (!sjson_impl::is_parse_cache_header_valid(header, key) || header.document_size != cache_size - sizeof(header))
+			return nullptr;
+
+		out_document_size = static_cast<size_t>(header.document_size);
+		return static_cast<const uint8_t*>(cache_data) + sizeof(header);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Reads the binary document of a cache file.
+	// Returns its size once read or 0 if the file is missing, stale, or truncated.
+	// Call with a nullptr buffer to query its size, nothing is read then.
+	// A buffer too small to hold the document is treated as a miss and 0 is returned.
+	//////////////////////////////////////////////////////////////////////////
+	inline size_t read_parse_cache(const char* cache_path, const ParseCacheKey& key, void* buffer, size_t buffer_size)
+	{
+		std::FILE* file = sjson_impl::open_file(cache_path, "rb");
+		if (file == nullptr)
+			return 0;
+
+		size_t document_size = 0;
+
+		sjson_impl::ParseCacheHeader header;
+		if (std::fread(&header, sizeof(header), 1, file) == 1 && sjson_impl::is_parse_cache_header_valid(header, key))
+		{
+			document_size = static_cast<size_t>(header.document_size);
+
+			if (buffer != nullptr)
+			{
+				// Any trailing byte means the file was not written by us, treat it as a miss
+				if (buffer_size < document_size || std::fread(buffer, sizeof(char), document_size, file) != document_size || std::fgetc(file) != EOF)
+					document_size = 0;
+			}
+		}
+
+		std::fclose(file);
+		return document_size;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a binary document compiled from the input identified by the key.
+	// The file is written next to the cache with a .tmp suffix and renamed into place once complete,
+	// a reader never sees a partially written cache. On Windows, where a rename cannot replace
+	// a file, the previous cache is removed first and is briefly missing.
+	// Returns false if the file could not be written, the previous cache is then left as-is.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool write_parse_cache(const char* cache_path, const ParseCacheKey& key, const void* document, size_t document_size)
+	{
+		if (document == nullptr || document_size == 0)
+			return false;
+
+		const char temp_suffix[] = ".tmp";
+		const size_t cache_path_length = std::strlen(cache_path);
+
+		char temp_path[FILENAME_MAX];
+		if (cache_path_length + sizeof(temp_suffix) > sizeof(temp_path))
+			return false;
+
+		std::memcpy(temp_path, cache_path, cache_path_length);
+		std::memcpy(temp_path + cache_path_length, temp_suffix, sizeof(temp_suffix));
+
+		std::FILE* file = sjson_impl::open_file(temp_path, "wb");
+		if (file == nullptr)
+			return false;
+
+		sjson_impl::ParseCacheHeader header;
+		header.tag = sjson_impl::k_parse_cache_tag;
+		header.version = sjson_impl::k_parse_cache_version;
+		header.binary_version = sjson_impl::k_binary_version;
+		header.padding = 0;
+		header.input_size = key.input_size;
+		header.input_hash = key.input_hash;
+		header.document_size = document_size;
+
+		const bool is_written = std::fwrite(&header, sizeof(header), 1, file) == 1
+			&& std::fwrite(document, sizeof(char), document_size, file) == document_size;
+
+		const bool is_closed = std::fclose(file) == 0;
+		if (!is_written || !is_closed)
+		{
+			std::remove(temp_path);
+			return false;
+		}
+
+#if defined(_WIN32)
+		std::remove(cache_path);
+#endif
+
+		if (std::rename(temp_path, cache_path) != 0)
+		{
+			std::remove(temp_path);
+			return false;
+		}
+
+		return true;
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
@@ -29,10 +29,17 @@
 	#define SJSON_CPP_PARSER
 #endif
 
+#include "sjson/key.h"
 #include "sjson/parser_error.h"
 #include "sjson/parser_state.h"
 #include "sjson/version.h"
+#include "sjson/impl/base64.impl.h"
 #include "sjson/impl/cstdlib.impl.h"
+#include "sjson/impl/hex_float.impl.h"
+#include "sjson/impl/number_conversion.impl.h"
+#include "sjson/impl/string_escape.impl.h"
+#include "sjson/impl/text_layout.impl.h"
+#include "sjson/impl/utf8.impl.h"
 #include "sjson/string_view.h"
 
 #include <algorithm>
@@ -41,18 +48,62 @@
 #include <cstring>
 #include <cstdint>
 #include <limits>
+#include <type_traits>
 
 namespace sjson
 {
 	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
 
+	class DocumentEditor;
+	class EventParser;
+	class PathQuery;
+	class StreamTransform;
+
+	namespace sjson_impl
+	{
+		class BinaryCompiler;
+		struct ParserAccess;
+	}
+
+	// The kind of value that comes next, see Parser::peek_value_type
+	enum class ValueType : uint8_t
+	{
+		Invalid,
+		Object,
+		Array,
+		String,
+		Number,
+		Bool,
+		Null,
+	};
+
+	// Selects the Parser constructor over a mutable buffer, e.g.: Parser parser(buffer, buffer_size, MutableInput());
+	struct MutableInput {};
+
 	class Parser
 	{
 	public:
+		// The deepest nesting of objects and arrays that skip_value supports
+		static constexpr uint32_t k_max_skip_depth = 64;
+
 		Parser(const char* input, size_t input_length)
 			: m_input(input)
 			, m_input_length(input_length)
 			, m_state(input, input_length)
+			, m_mutable_input(nullptr)
+			, m_is_utf8_validation_enabled(false)
+		{
+			skip_bom();
+		}
+
+		// A parser over a mutable buffer can also unescape strings in place, see read_unescaped_in_situ.
+		// The buffer is only ever modified by that function.
+		Parser(char* input, size_t input_length, MutableInput)
+			: m_input(input)
+			, m_input_length(input_length)
+			, m_state(input, input_length)
+			, m_mutable_input(input)
+			, m_is_utf8_validation_enabled(false)
 		{
 			skip_bom();
 		}
@@ -67,10 +118,10 @@ namespace sjson
 		Parser& operator=(Parser&& other) = default;
 
 		bool object_begins() { return read_opening_brace(); }
-		bool object_begins(const char* having_name) { return read_key(having_name) && read_equal_sign() && object_begins(); }
+		bool object_begins(const Key& having_name) { return read_key(having_name) && read_equal_sign() && object_begins(); }
 		bool object_ends() { return read_closing_brace(); }
 
-		bool try_object_begins(const char* having_name)
+		bool try_object_begins(const Key& having_name)
 		{
 			ParserState s = save_state();
 
@@ -97,10 +148,10 @@ namespace sjson
 		}
 
 		bool array_begins() { return read_opening_bracket(); }
-		bool array_begins(const char* having_name) { return read_key(having_name) && read_equal_sign() && read_opening_bracket(); }
+		bool array_begins(const Key& having_name) { return read_key(having_name) && read_equal_sign() && read_opening_bracket(); }
 		bool array_ends() { return read_closing_bracket(); }
 
-		bool try_array_begins(const char* having_name)
+		bool try_array_begins(const Key& having_name)
 		{
 			ParserState s = save_state();
 
@@ -127,7 +178,7 @@ namespace sjson
 		}
 
 		// TODO: To support 'null' value entries (e.g. foo = null), these functions should take as an argument an Option
-		// e.g. bool read(const char* key, Option<bool>& value)
+		// e.g. bool read(const Key& key, Option<bool>& value)
 		// The return value tells us whether or not we successfully parsed our key/value pair
 		// The option returned tells us whether we parsed an actual value or a null literal
 		// The caller is responsible for interpreting the meaning of this
@@ -139,30 +190,194 @@ namespace sjson
 		// Only the start/end quote is stripped from the returned string.
 		// e.g.: some_key = "this is an \"escaped\" string within another string"
 		//  StringView start ^                                             end ^
-		bool read(const char* key, StringView& value) { return read_key(key) && read_equal_sign() && read_string(value); }
-		bool read(const char* key, bool& value) { return read_key(key) && read_equal_sign() && read_bool(value); }
-		bool read(const char* key, double& value) { return read_key(key) && read_equal_sign() && read_double(&value, nullptr); }
-		bool read(const char* key, float& value) { return read_key(key) && read_equal_sign() && read_double(nullptr, &value); }
-		bool read(const char* key, int8_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
-		bool read(const char* key, uint8_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
-		bool read(const char* key, int16_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
-		bool read(const char* key, uint16_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
-		bool read(const char* key, int32_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
-		bool read(const char* key, uint32_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
-		bool read(const char* key, int64_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
-		bool read(const char* key, uint64_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
-
-		bool read(const char* key, double* values, uint32_t num_elements)
+		bool read(const Key& key, StringView& value) { return read_key(key) && read_equal_sign() && read_string(value); }
+		bool read(const Key& key, bool& value) { return read_key(key) && read_equal_sign() && read_bool(value); }
+		bool read(const Key& key, double& value) { return read_key(key) && read_equal_sign() && read_double(&value, nullptr); }
+		bool read(const Key& key, float& value) { return read_key(key) && read_equal_sign() && read_double(nullptr, &value); }
+		bool read(const Key& key, int8_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
+		bool read(const Key& key, uint8_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
+		bool read(const Key& key, int16_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
+		bool read(const Key& key, uint16_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
+		bool read(const Key& key, int32_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
+		bool read(const Key& key, uint32_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
+		bool read(const Key& key, int64_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
+		bool read(const Key& key, uint64_t& value) { return read_key(key) && read_equal_sign() && read_integer(value); }
+
+		// Validates the syntax of a number and returns its raw span without converting it.
+		// It can be converted later with to_double, to_float, or to_int from sjson/number_token.h
+		// e.g.: some_key = -1.5e3
+		bool read_number_token(const Key& key, StringView& value) { return read_key(key) && read_equal_sign() && read_number_token(value); }
+
+		bool read(const Key& key, double* values, uint32_t num_elements)
 		{
 			return read_key(key) && read_equal_sign() && read_opening_bracket() && read(values, num_elements) && read_closing_bracket();
 		}
 
-		bool read(const char* key, StringView* values, uint32_t num_elements)
+		bool read(const Key& key, StringView* values, uint32_t num_elements)
 		{
 			return read_key(key) && read_equal_sign() && read_opening_bracket() && read(values, num_elements) && read_closing_bracket();
 		}
 
-		bool try_read(const char* key, StringView& value, const char* default_value)
+		// Reads an array of rows where every row is an array of inner_size numbers, e.g.: rotations = [ [ 0, 0, 0, 1 ], [ 0, 1, 0, 0 ] ]
+		// Exactly outer_count rows are expected. The first value of every row is written stride bytes after the first value
+		// of the previous row, this allows writing straight into an array of structs.
+		// e.g.: read_matrix("rotations", &transforms[0].rotation[0], 4, num_transforms, sizeof(Transform))
+		template<typename NumberType>
+		bool read_matrix(const Key& key, NumberType* values, uint32_t inner_size, uint32_t outer_count, size_t stride)
+		{
+			return read_key(key) && read_equal_sign() && read_matrix(values, inner_size, outer_count, stride);
+		}
+
+		// Rows are packed one after the other
+		template<typename NumberType>
+		bool read_matrix(const Key& key, NumberType* values, uint32_t inner_size, uint32_t outer_count)
+		{
+			return read_matrix(key, values, inner_size, outer_count, inner_size * sizeof(NumberType));
+		}
+
+		// Reads an array of numbers converted to IEEE 754 half floats, rounded to nearest even
+		bool read_half(const Key& key, uint16_t* values, uint32_t num_elements)
+		{
+			return read_key(key) && read_equal_sign() && read_opening_bracket() && read_half(values, num_elements) && read_closing_bracket();
+		}
+
+		// Reads an array of numbers converted to normalized 8 or 16 bit integers.
+		// Signed integers map [-1.0, 1.0] to [-max, max] and unsigned integers map [0.0, 1.0] to [0, max],
+		// numbers outside the range are clamped, e.g.: 0.5 is read as 16384 into an int16_t and as 128 into a uint8_t
+		template<typename IntegerType>
+		bool read_normalized(const Key& key, IntegerType* values, uint32_t num_elements)
+		{
+			return read_key(key) && read_equal_sign() && read_opening_bracket() && read_normalized(values, num_elements) && read_closing_bracket();
+		}
+
+		// Reads a base64 string written by ObjectWriter::insert_blob and decodes it straight into the destination.
+		// The decoded size must match the destination size exactly.
+		// Typed variants read the raw bytes of the values in native endianness,
+		// the number of elements is provided instead of the size in bytes.
+		bool read_blob(const Key& key, void* data, size_t data_size)
+		{
+			StringView value;
+			if (!read(key, value))
+				return false;
+
+			if (!sjson_impl::decode_base64(value.c_str(), value.size(), static_cast<uint8_t*>(data), data_size))
+			{
+				set_error(ParserError::InvalidBlob);
+				return false;
+			}
+
+			return true;
+		}
+
+		template<typename T, typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr>
+		bool read_blob(const Key& key, T* values, size_t num_elements) { return read_blob(key, static_cast<void*>(values), num_elements * sizeof(T)); }
+
+		// Reads a string and replaces its escape sequences by the characters they represent, see sjson_impl::unescape_string.
+		// Strings without escape sequences are returned as a view of the input and the buffer is left untouched,
+		// the others are unescaped into the buffer and the value returned points into it.
+		// Reading fails with ParserError::BufferTooSmall if the unescaped string does not fit.
+		bool read_unescaped(const Key& key, char* buffer, size_t buffer_size, StringView& value)
+		{
+			if (!read_key(key) || !read_equal_sign())
+				return false;
+
+			ParserState start_of_string = save_state();
+
+			StringView raw_value;
+			bool has_escape_sequences;
+			if (!read_string(raw_value, has_escape_sequences))
+				return false;
+
+			if (!has_escape_sequences)
+			{
+				value = raw_value;
+				return true;
+			}
+
+			// The unescaped string is never longer, only measure it when it might not fit
+			if (buffer_size < raw_value.size() && sjson_impl::unescape_string(raw_value.c_str(), raw_value.size(), nullptr) > buffer_size)
+			{
+				restore_state(start_of_string);
+				set_error(ParserError::BufferTooSmall);
+				return false;
+			}
+
+			const size_t length = sjson_impl::unescape_string(raw_value.c_str(), raw_value.size(), buffer);
+			value = StringView(buffer, length);
+			return true;
+		}
+
+		// Same as read_unescaped but the string is unescaped inside the input buffer, the parser must
+		// have been constructed with a mutable buffer or reading fails with ParserError::InputNotMutable.
+		// The input is modified destructively: restoring a state saved before the string and reading
+		// it again is not supported.
+		bool read_unescaped_in_situ(const Key& key, StringView& value)
+		{
+			if (m_mutable_input == nullptr)
+			{
+				set_error(ParserError::InputNotMutable);
+				return false;
+			}
+
+			if (!read_key(key) || !read_equal_sign())
+				return false;
+
+			StringView raw_value;
+			bool has_escape_sequences;
+			if (!read_string(raw_value, has_escape_sequences))
+				return false;
+
+			if (!has_escape_sequences)
+			{
+				value = raw_value;
+				return true;
+			}
+
+			char* string_start = m_mutable_input + (raw_value.c_str() - m_input);
+			const size_t length = sjson_impl::unescape_string(string_start, raw_value.size(), string_start);
+			value = StringView(string_start, length);
+			return true;
+		}
+
+		// Reads a string and maps it to a value with a table of names, see EnumEntry.
+		// Reading fails with ParserError::UnknownEnumValue if the string matches none of the names.
+		// e.g.: some_key = "rotation"
+		template<typename EnumType, size_t N>
+		bool read_enum(const Key& key, EnumType& value, const EnumEntry<EnumType> (&table)[N])
+		{
+			return read_key(key) && read_equal_sign() && read_enum_value(value, table, N);
+		}
+
+		// e.g.: some_key = [ "rotation", "translation" ]
+		template<typename EnumType, size_t N>
+		bool read_enum(const Key& key, EnumType* values, uint32_t num_elements, const EnumEntry<EnumType> (&table)[N])
+		{
+			return read_key(key) && read_equal_sign() && read_opening_bracket() && read_enum(values, num_elements, table) && read_closing_bracket();
+		}
+
+		template<typename EnumType, size_t N>
+		bool try_read_enum(const Key& key, EnumType& value, const EnumEntry<EnumType> (&table)[N], EnumType default_value)
+		{
+			ParserState s = save_state();
+
+			if (read_key(key) && read_equal_sign())
+			{
+				if (try_read_null())
+				{
+					value = default_value;
+					return false;
+				}
+
+				if (read_enum_value(value, table, N))
+					return true;
+			}
+
+			restore_state(s);
+			value = default_value;
+			return false;
+		}
+
+		bool try_read(const Key& key, StringView& value, const char* default_value)
 		{
 			ParserState s = save_state();
 
@@ -183,7 +398,7 @@ namespace sjson
 			return false;
 		}
 
-		bool try_read(const char* key, bool& value, bool default_value)
+		bool try_read(const Key& key, bool& value, bool default_value)
 		{
 			ParserState s = save_state();
 
@@ -204,7 +419,7 @@ namespace sjson
 			return false;
 		}
 
-		bool try_read(const char* key, double& value, double default_value)
+		bool try_read(const Key& key, double& value, double default_value)
 		{
 			ParserState s = save_state();
 
@@ -225,7 +440,7 @@ namespace sjson
 			return false;
 		}
 
-		bool try_read(const char* key, float& value, float default_value)
+		bool try_read(const Key& key, float& value, float default_value)
 		{
 			ParserState s = save_state();
 
@@ -246,16 +461,16 @@ namespace sjson
 			return false;
 		}
 
-		bool try_read(const char* key, int8_t& value, int8_t default_value) { return try_read_integer_impl<int8_t>(key, value, default_value); }
-		bool try_read(const char* key, uint8_t& value, uint8_t default_value) { return try_read_integer_impl<uint8_t>(key, value, default_value); }
-		bool try_read(const char* key, int16_t& value, int16_t default_value) { return try_read_integer_impl<int16_t>(key, value, default_value); }
-		bool try_read(const char* key, uint16_t& value, uint16_t default_value) { return try_read_integer_impl<uint16_t>(key, value, default_value); }
-		bool try_read(const char* key, int32_t& value, int32_t default_value) { return try_read_integer_impl<int32_t>(key, value, default_value); }
-		bool try_read(const char* key, uint32_t& value, uint32_t default_value) { return try_read_integer_impl<uint32_t>(key, value, default_value); }
-		bool try_read(const char* key, int64_t& value, int64_t default_value) { return try_read_integer_impl<int64_t>(key, value, default_value); }
-		bool try_read(const char* key, uint64_t& value, uint64_t default_value) { return try_read_integer_impl<uint64_t>(key, value, default_value); }
+		bool try_read(const Key& key, int8_t& value, int8_t default_value) { return try_read_integer_impl<int8_t>(key, value, default_value); }
+		bool try_read(const Key& key, uint8_t& value, uint8_t default_value) { return try_read_integer_impl<uint8_t>(key, value, default_value); }
+		bool try_read(const Key& key, int16_t& value, int16_t default_value) { return try_read_integer_impl<int16_t>(key, value, default_value); }
+		bool try_read(const Key& key, uint16_t& value, uint16_t default_value) { return try_read_integer_impl<uint16_t>(key, value, default_value); }
+		bool try_read(const Key& key, int32_t& value, int32_t default_value) { return try_read_integer_impl<int32_t>(key, value, default_value); }
+		bool try_read(const Key& key, uint32_t& value, uint32_t default_value) { return try_read_integer_impl<uint32_t>(key, value, default_value); }
+		bool try_read(const Key& key, int64_t& value, int64_t default_value) { return try_read_integer_impl<int64_t>(key, value, default_value); }
+		bool try_read(const Key& key, uint64_t& value, uint64_t default_value) { return try_read_integer_impl<uint64_t>(key, value, default_value); }
 
-		bool try_read(const char* key, double* values, uint32_t num_elements, double default_value)
+		bool try_read(const Key& key, double* values, uint32_t num_elements, double default_value)
 		{
 			ParserState s = save_state();
 
@@ -276,7 +491,7 @@ namespace sjson
 			return false;
 		}
 
-		bool try_read(const char* key, StringView* values, uint32_t num_elements, const char* default_value)
+		bool try_read(const Key& key, StringView* values, uint32_t num_elements, const char* default_value)
 		{
 			ParserState s = save_state();
 
@@ -314,6 +529,165 @@ namespace sjson
 			return true;
 		}
 
+		template<typename NumberType>
+		bool read_matrix(NumberType* values, uint32_t inner_size, uint32_t outer_count, size_t stride)
+		{
+			static_assert(std::is_arithmetic<NumberType>::value && !std::is_same<NumberType, bool>::value, "Matrices can only hold numbers");
+			SJSON_CPP_ASSERT(stride >= inner_size * sizeof(NumberType), "Matrix rows overlap, the stride must be at least %u bytes", uint32_t(inner_size * sizeof(NumberType)));
+
+			if (!read_opening_bracket())
+				return false;
+
+			char* row = reinterpret_cast<char*>(values);
+			for (uint32_t row_index = 0; row_index < outer_count; ++row_index)
+			{
+				if (row_index != 0 && !read_comma())
+					return false;
+
+				if (!read_opening_bracket())
+					return false;
+
+				NumberType* row_values = reinterpret_cast<NumberType*>(row);
+				for (uint32_t column_index = 0; column_index < inner_size; ++column_index)
+				{
+					if (column_index != 0 && !read_comma())
+						return false;
+
+					if (!read_number(row_values[column_index]))
+						return false;
+				}
+
+				if (!read_closing_bracket())
+					return false;
+
+				row += stride;
+			}
+
+			return read_closing_bracket();
+		}
+
+		bool read_half(uint16_t* values, uint32_t num_elements)
+		{
+			float chunk[sjson_impl::k_conversion_chunk_size];
+
+			for (uint32_t chunk_offset = 0; chunk_offset < num_elements; chunk_offset += sjson_impl::k_conversion_chunk_size)
+			{
+				const uint32_t chunk_size = std::min(num_elements - chunk_offset, sjson_impl::k_conversion_chunk_size);
+				if (!read_float_chunk(chunk, chunk_offset, chunk_size))
+					return false;
+
+				sjson_impl::convert_to_half(chunk, values + chunk_offset, chunk_size);
+			}
+
+			return true;
+		}
+
+		template<typename IntegerType>
+		bool read_normalized(IntegerType* values, uint32_t num_elements)
+		{
+			float chunk[sjson_impl::k_conversion_chunk_size];
+
+			for (uint32_t chunk_offset = 0; chunk_offset < num_elements; chunk_offset += sjson_impl::k_conversion_chunk_size)
+			{
+				const uint32_t chunk_size = std::min(num_elements - chunk_offset, sjson_impl::k_conversion_chunk_size);
+				if (!read_float_chunk(chunk, chunk_offset, chunk_size))
+					return false;
+
+				sjson_impl::convert_to_normalized(chunk, values + chunk_offset, chunk_size);
+			}
+
+			return true;
+		}
+
+		bool read_number_token(StringView& value)
+		{
+			if (!skip_comments_and_whitespace_fail_if_eof())
+				return false;
+
+			const size_t start_offset = m_state.offset;
+
+			if (m_state.symbol == '-')
+				advance();
+
+			if (!std::isdigit(static_cast<unsigned char>(m_state.symbol)))
+			{
+				set_error(ParserError::NumberExpected);
+				return false;
+			}
+
+			bool is_hex = false;
+			if (m_state.symbol == '0')
+			{
+				advance();
+				is_hex = m_state.symbol == 'x' || m_state.symbol == 'X';
+			}
+
+			if (is_hex)
+			{
+				advance();
+
+				if (!is_hex_digit(m_state.symbol))
+				{
+					set_error(ParserError::InvalidNumber);
+					return false;
+				}
+
+				while (is_hex_digit(m_state.symbol))
+					advance();
+
+				if (m_state.symbol == '.')
+				{
+					advance();
+
+					while (is_hex_digit(m_state.symbol))
+						advance();
+				}
+
+				if ((m_state.symbol == 'p' || m_state.symbol == 'P') && !skip_exponent())
+					return false;
+			}
+			else
+			{
+				while (std::isdigit(static_cast<unsigned char>(m_state.symbol)))
+					advance();
+
+				if (m_state.symbol == '.')
+				{
+					advance();
+
+					while (std::isdigit(static_cast<unsigned char>(m_state.symbol)))
+						advance();
+				}
+
+				if ((m_state.symbol == 'e' || m_state.symbol == 'E') && !skip_exponent())
+					return false;
+			}
+
+			if (std::isalnum(static_cast<unsigned char>(m_state.symbol)) || m_state.symbol == '.' || m_state.symbol == '_')
+			{
+				set_error(ParserError::InvalidNumber);
+				return false;
+			}
+
+			value = StringView(m_input + start_offset, m_state.offset - start_offset);
+			return true;
+		}
+
+		template<typename EnumType, size_t N>
+		bool read_enum(EnumType* values, uint32_t num_elements, const EnumEntry<EnumType> (&table)[N])
+		{
+			for (uint32_t i = 0; i < num_elements; ++i)
+			{
+				if (!read_enum_value(values[i], table, N))
+					return false;
+
+				if (i < (num_elements - 1) && !read_comma())
+					return false;
+			}
+
+			return true;
+		}
+
 		bool read(StringView* values, uint32_t num_elements)
 		{
 			if (num_elements == 0)
@@ -331,6 +705,126 @@ namespace sjson
 			return true;
 		}
 
+		// Skips the next value whatever its type, nested objects and arrays included.
+		// Numbers are only scanned, they are not converted. Objects and arrays nested deeper
+		// than k_max_skip_depth levels fail with ParserError::NestingTooDeep.
+		bool skip_value()
+		{
+			// One bit per open object or array, set for arrays, the innermost one is the lowest bit
+			uint64_t array_levels = 0;
+			uint32_t depth = 0;
+
+			while (true)
+			{
+				if (!skip_comments_and_whitespace_fail_if_eof())
+					return false;
+
+				bool is_container_closed = false;
+				if (m_state.symbol == '{' || m_state.symbol == '[')
+				{
+					if (depth == k_max_skip_depth)
+					{
+						set_error(ParserError::NestingTooDeep);
+						return false;
+					}
+
+					const bool is_array = m_state.symbol == '[';
+					advance();
+
+					array_levels = (array_levels << 1) | (is_array ? 1 : 0);
+					depth++;
+
+					is_container_closed = is_array ? try_array_ends() : try_object_ends();
+					if (!is_container_closed)
+					{
+						StringView key;
+						if (!is_array && !read_any_key(key))
+							return false;
+
+						continue;
+					}
+				}
+				else if (!skip_scalar())
+					return false;
+
+				// The value is complete, close the objects and arrays that end with it and move on to the next member or element
+				while (true)
+				{
+					if (is_container_closed)
+					{
+						array_levels >>= 1;
+						depth--;
+						is_container_closed = false;
+					}
+
+					if (depth == 0)
+						return true;
+
+					const bool is_array = (array_levels & 1) != 0;
+					if (is_array ? try_array_ends() : try_object_ends())
+					{
+						is_container_closed = true;
+						continue;
+					}
+
+					StringView key;
+					if (is_array ? !read_comma() : !read_any_key(key))
+						return false;
+
+					break;
+				}
+			}
+		}
+
+		// Returns the key of the next member without consuming anything.
+		// The StringView value returned is a raw view of the SJSON buffer, see read_string.
+		bool peek_key(StringView& key)
+		{
+			ParserState s = save_state();
+			const bool is_key = read_any_key(key);
+			restore_state(s);
+			return is_key;
+		}
+
+		// Returns the kind of the next value without consuming anything, if a key comes next it is the kind
+		// of its value. The kind is determined from the first character of the value, reading it can still fail.
+		ValueType peek_value_type()
+		{
+			ParserState s = save_state();
+
+			StringView key;
+			if (!read_any_key(key))
+				restore_state(s);
+
+			ValueType type = ValueType::Invalid;
+			if (skip_comments_and_whitespace() && !eof())
+			{
+				switch (m_state.symbol)
+				{
+				case '{':	type = ValueType::Object; break;
+				case '[':	type = ValueType::Array; break;
+				case '"':	type = ValueType::String; break;
+				case 't':
+				case 'f':	type = ValueType::Bool; break;
+				case 'n':	type = ValueType::Null; break;
+				default:
+					if (m_state.symbol == '-' || std::isdigit(static_cast<unsigned char>(m_state.symbol)))
+						type = ValueType::Number;
+					break;
+				}
+			}
+
+			restore_state(s);
+			return type;
+		}
+
+		// Skips the next key and its value, e.g.: a member found with peek_key that is not needed
+		bool skip_member()
+		{
+			StringView key;
+			return read_any_key(key) && skip_value();
+		}
+
 		bool read_comma()			{ return read_symbol(',', ParserError::CommaExpected); }
 
 		bool remainder_is_comments_and_whitespace()
@@ -354,7 +848,7 @@ namespace sjson
 				if (eof())
 					return true;
 
-				if (std::isspace(static_cast<unsigned char>(m_state.symbol)))
+				if (sjson_impl::is_whitespace(m_state.symbol))
 				{
 					advance();
 					continue;
@@ -374,6 +868,11 @@ namespace sjson
 			}
 		}
 
+		// When enabled, string values and quoted keys must be well-formed UTF-8,
+		// reading them fails with ParserError::InvalidUtf8 otherwise. Disabled by default.
+		void set_utf8_validation(bool is_enabled) { m_is_utf8_validation_enabled = is_enabled; }
+		bool is_utf8_validation_enabled() const { return m_is_utf8_validation_enabled; }
+
 		void get_position(uint32_t& line, uint32_t& column) const
 		{
 			line = m_state.line;
@@ -396,6 +895,11 @@ namespace sjson
 		size_t m_input_length;
 		ParserState m_state;
 
+		// Only set when strings can be unescaped in place
+		char* m_mutable_input;
+
+		bool m_is_utf8_validation_enabled;
+
 		bool read_equal_sign()		{ return read_symbol('=', ParserError::EqualSignExpected); }
 		bool read_opening_brace()	{ return read_symbol('{', ParserError::OpeningBraceExpected); }
 		bool read_closing_brace()	{ return read_symbol('}', ParserError::ClosingBraceExpected); }
@@ -473,26 +977,37 @@ namespace sjson
 			}
 		}
 
-		bool read_key(const char* having_name)
+		bool read_key(const Key& having_name)
 		{
 			if (!skip_comments_and_whitespace_fail_if_eof())
 				return false;
 
 			ParserState start_of_key = save_state();
 			StringView actual;
+			bool is_match;
 
 			if (m_state.symbol == '"')
 			{
-				if (!read_string(actual))
+				// Quoted keys can contain escape sequences, e.g.: "a\"b" is the key a"b
+				bool has_escape_sequences;
+				if (!read_string(actual, has_escape_sequences))
 					return false;
+
+				if (has_escape_sequences)
+					is_match = sjson_impl::is_unescaped_string_equal(actual.c_str(), actual.size(), having_name.c_str(), having_name.size());
+				else
+					is_match = having_name == actual;
 			}
 			else
 			{
-				if (!read_unquoted_key(actual))
+				uint32_t actual_hash;
+				if (!read_unquoted_key(actual, actual_hash))
 					return false;
+
+				is_match = actual_hash == having_name.get_hash() && having_name == actual;
 			}
 
-			if (actual != having_name)
+			if (!is_match)
 			{
 				restore_state(start_of_key);
 				set_error(ParserError::IncorrectKey);
@@ -502,11 +1017,49 @@ namespace sjson
 			return true;
 		}
 
+		// Reads the next key whatever its name, along with the equal sign that follows
+		bool read_any_key(StringView& key)
+		{
+			uint32_t hash;
+			return read_any_key(key, hash);
+		}
+
+		// Same as above and the key is hashed like a Key
+		bool read_any_key(StringView& key, uint32_t& hash)
+		{
+			if (!skip_comments_and_whitespace_fail_if_eof())
+				return false;
+
+			if (m_state.symbol == '"')
+			{
+				if (!read_string(key))
+					return false;
+
+				hash = sjson_impl::hash_key_runtime(key.c_str(), key.size());
+			}
+			else
+			{
+				if (!read_unquoted_key(key, hash))
+					return false;
+			}
+
+			return read_equal_sign();
+		}
+
 		// The StringView value returned is a raw view of the SJSON buffer. Nothing is unescaped:
 		// escaped quotation marks will remain, escaped unicode sequences will remain, etc.
-		// It is the responsibility of the caller to handle this in a meaningful way.
+		// It is the responsibility of the caller to handle this in a meaningful way, see read_unescaped.
 		bool read_string(StringView& value)
 		{
+			bool has_escape_sequences;
+			return read_string(value, has_escape_sequences);
+		}
+
+		// Same as above and records whether the string contains any escape sequence
+		bool read_string(StringView& value, bool& has_escape_sequences)
+		{
+			has_escape_sequences = false;
+
 			if (!skip_comments_and_whitespace_fail_if_eof())
 				return false;
 
@@ -540,6 +1093,7 @@ namespace sjson
 				{
 					// Strings are returned as slices of the input, so escape sequences cannot be un-escaped.
 					// Assume the escape sequence is valid and skip over it.
+					has_escape_sequences = true;
 					advance();
 
 					if (m_state.symbol == 'u')
@@ -547,29 +1101,54 @@ namespace sjson
 						advance();
 
 						// This is an escaped unicode character, skip the 4 bytes that follow
-						advance();
-						advance();
-						advance();
-						advance();
-					}
-					else
-					{
-						advance();
+						for (uint32_t digit_index = 0; digit_index < 4; ++digit_index)
+						{
+							if (!advance_string_symbol())
+								return false;
+						}
 					}
+					else if (!advance_string_symbol())
+						return false;
 				}
-				else
+				else if (!advance_string_symbol())
+					return false;
+			}
+
+			value = StringView(m_input + start_offset, end_offset - start_offset + 1);
+			return true;
+		}
+
+		// Advances past a symbol of a string. When validating UTF-8, a symbol outside the ASCII range
+		// must begin a well-formed sequence and the whole sequence is skipped, the error is reported at its first byte.
+		bool advance_string_symbol()
+		{
+			if (m_is_utf8_validation_enabled && static_cast<unsigned char>(m_state.symbol) >= 0x80)
+			{
+				const size_t sequence_length = sjson_impl::get_utf8_sequence_length(m_input, m_input_length, m_state.offset);
+				if (sequence_length == 0)
 				{
-					advance();
+					set_error(ParserError::InvalidUtf8);
+					return false;
 				}
+
+				for (size_t continuation_index = 1; continuation_index < sequence_length; ++continuation_index)
+					advance();
 			}
 
-			value = StringView(m_input + start_offset, end_offset - start_offset + 1);
+			advance();
 			return true;
 		}
 
 		// Unquoted keys do not support escaped unicode literals or any form of escaping
 		// e.g. foo_\u0066_bar = "this is an invalid key"
 		bool read_unquoted_key(StringView& value)
+		{
+			uint32_t hash;
+			return read_unquoted_key(value, hash);
+		}
+
+		// The key is hashed as it is scanned, see Key
+		bool read_unquoted_key(StringView& value, uint32_t& hash)
 		{
 			if (eof())
 			{
@@ -579,6 +1158,7 @@ namespace sjson
 
 			size_t start_offset = m_state.offset;
 			size_t end_offset;
+			hash = sjson_impl::k_key_hash_seed;
 
 			while (true)
 			{
@@ -606,13 +1186,14 @@ namespace sjson
 					break;
 				}
 
-				if (std::isspace(static_cast<unsigned char>(m_state.symbol)))
+				if (sjson_impl::is_whitespace(m_state.symbol))
 				{
 					end_offset = m_state.offset - 1;
 					advance();
 					break;
 				}
 
+				hash = sjson_impl::hash_key_step(hash, m_state.symbol);
 				advance();
 			}
 
@@ -719,6 +1300,9 @@ namespace sjson
 			if (m_state.symbol == '0')
 			{
 				advance();
+
+				if (m_state.symbol == 'x' || m_state.symbol == 'X')
+					return read_hex_double(start_offset, dbl_value, flt_value);
 			}
 			else if (std::isdigit(static_cast<unsigned char>(m_state.symbol)))
 			{
@@ -785,6 +1369,126 @@ namespace sjson
 			return true;
 		}
 
+		// Hexadecimal floating point values are decoded with bit manipulation, e.g.: 0x1.9p+3
+		// This function assumes that the '0' before the 'x' has already been consumed
+		bool read_hex_double(size_t start_offset, double* dbl_value, float* flt_value)
+		{
+			advance();
+
+			bool was_exponent_symbol = false;
+			while (is_hex_digit(m_state.symbol) || m_state.symbol == '.' || m_state.symbol == 'p' || m_state.symbol == 'P'
+				|| (was_exponent_symbol && (m_state.symbol == '+' || m_state.symbol == '-')))
+			{
+				was_exponent_symbol = m_state.symbol == 'p' || m_state.symbol == 'P';
+				advance();
+			}
+
+			double value;
+			if (!sjson_impl::parse_hex_double(m_input + start_offset, m_state.offset - start_offset, value))
+			{
+				set_error(ParserError::InvalidNumber);
+				return false;
+			}
+
+			if (dbl_value != nullptr)
+				*dbl_value = value;
+			else
+				*flt_value = static_cast<float>(value);
+
+			return true;
+		}
+
+		template<typename EnumType>
+		bool read_enum_value(EnumType& value, const EnumEntry<EnumType>* table, size_t num_entries)
+		{
+			if (!skip_comments_and_whitespace_fail_if_eof())
+				return false;
+
+			ParserState start_of_string = save_state();
+
+			StringView name;
+			if (!read_string(name))
+				return false;
+
+			if (!sjson_impl::find_enum_value(name, table, num_entries, value))
+			{
+				restore_state(start_of_string);
+				set_error(ParserError::UnknownEnumValue);
+				return false;
+			}
+
+			return true;
+		}
+
+		// Reads the next chunk of an array of numbers, chunk_offset is the index of its first element within the array
+		bool read_float_chunk(float* chunk, uint32_t chunk_offset, uint32_t chunk_size)
+		{
+			for (uint32_t i = 0; i < chunk_size; ++i)
+			{
+				if ((chunk_offset + i) != 0 && !read_comma())
+					return false;
+
+				if (!read_double(nullptr, &chunk[i]))
+					return false;
+			}
+
+			return true;
+		}
+
+		bool read_number(double& value) { return read_double(&value, nullptr); }
+		bool read_number(float& value) { return read_double(nullptr, &value); }
+
+		template<typename IntegralType, typename std::enable_if<std::is_integral<IntegralType>::value>::type* = nullptr>
+		bool read_number(IntegralType& value) { return read_integer(value); }
+
+		// Skips a string, a bool, null, or a number
+		bool skip_scalar()
+		{
+			switch (m_state.symbol)
+			{
+			case '"':
+			{
+				StringView value;
+				return read_string(value);
+			}
+			case 'n':
+			case 't':
+			case 'f':
+			{
+				if (try_read_null())
+					return true;
+
+				bool value;
+				return read_bool(value);
+			}
+			default:
+			{
+				StringView value;
+				return read_number_token(value);
+			}
+			}
+		}
+
+		// Skips an exponent marker, its optional sign, and its digits
+		bool skip_exponent()
+		{
+			advance();
+
+			if (m_state.symbol == '+' || m_state.symbol == '-')
+				advance();
+
+			if (!std::isdigit(static_cast<unsigned char>(m_state.symbol)))
+			{
+				set_error(ParserError::InvalidNumber);
+				return false;
+			}
+
+			while (std::isdigit(static_cast<unsigned char>(m_state.symbol)))
+				advance();
+
+			return true;
+		}
+
 		template<typename IntegralType>
 		bool read_integer(IntegralType& value)
 		{
@@ -882,7 +1586,7 @@ namespace sjson
 		}
 
 		template<typename IntegerType>
-		bool try_read_integer_impl(const char* key, IntegerType& value, IntegerType default_value)
+		bool try_read_integer_impl(const Key& key, IntegerType& value, IntegerType default_value)
 		{
 			ParserState s = save_state();
 
@@ -1011,7 +1715,31 @@ namespace sjson
 			m_state.error.line = m_state.line;
 			m_state.error.column = m_state.column;
 		}
+
+		friend DocumentEditor;
+		friend EventParser;
+		friend PathQuery;
+		friend StreamTransform;
+		friend sjson_impl::BinaryCompiler;
+		friend sjson_impl::ParserAccess;
 	};
 
+	namespace sjson_impl
+	{
+		// Lets the readers built on top of the parser read a value once its key has been consumed
+		struct ParserAccess
+		{
+			static bool read_any_key(Parser& parser, StringView& key, uint32_t& hash) { return parser.read_any_key(key, hash); }
+			static bool try_read_null(Parser& parser) { return parser.try_read_null(); }
+			static void set_error(Parser& parser, uint32_t error) { parser.set_error(error); }
+
+			static bool read_value(Parser& parser, StringView& value) { return parser.read_string(value); }
+			static bool read_value(Parser& parser, bool& value) { return parser.read_bool(value); }
+
+			template<typename NumberType, typename std::enable_if<std::is_arithmetic<NumberType>::value>::type* = nullptr>
+			static bool read_value(Parser& parser, NumberType& value) { return parser.read_number(value); }
+		};
+	}
+
 	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
 }
@@ -55,6 +55,18 @@ namespace sjson
 			InvalidNumber,
 			NumberCouldNotBeConverted,
 			UnexpectedContentAtEnd,
+			InvalidBlob,
+			InvalidBinaryDocument,
+			PathNotFound,
+			EditConflict,
+			NestingTooDeep,
+			RequiredKeyMissing,
+			UnknownEnumValue,
+			BufferTooSmall,
+			InvalidUtf8,
+			TooManyEdits,
+			InputNotMutable,
+			DuplicateSchemaKey,
 
 			Last
 		};
@@ -111,6 +123,30 @@ namespace sjson
 				return "This number could not be converted";
 			case UnexpectedContentAtEnd:
 				return "There should not be any more content in this file";
+			case InvalidBlob:
+				return "The base64 blob is malformed or does not have the expected size";
+			case InvalidBinaryDocument:
+				return "The binary document is corrupted or was compiled with a different version";
+			case PathNotFound:
+				return "The path does not lead to an existing value";
+			case EditConflict:
+				return "This edit overlaps another edit of the document";
+			case NestingTooDeep:
+				return "Objects and arrays are nested too deeply";
+			case RequiredKeyMissing:
+				return "A key required by the schema is missing from this object";
+			case UnknownEnumValue:
+				return "This string does not match any of the expected names";
+			case BufferTooSmall:
+				return "The buffer provided is too small to hold the value";
+			case InvalidUtf8:
+				return "This string is not valid UTF-8";
+			case TooManyEdits:
+				return "The document has too many pending edits";
+			case InputNotMutable:
+				return "The parser was not constructed with a mutable input";
+			case DuplicateSchemaKey:
+				return "Two fields of the schema use the same key";
 			default:
 				return "Unknown error";
 			}
@@ -0,0 +1,228 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/error.h"
+#include "sjson/parser.h"
+#include "sjson/string_view.h"
+#include "sjson/version.h"
+#include "sjson/impl/path.impl.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	class QueryHandler
+	{
+	public:
+		virtual ~QueryHandler() = default;
+
+		// Called for every value matched by a path, with the index returned by PathQuery::add_path and
+		// the raw input text of the value, e.g.: [ 1, 2 ] or "some \"text\""
+		// The value can be read with a Parser of its own.
+		virtual void on_match(uint32_t path_index, const StringView& raw_value) = 0;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A PathQuery extracts the values found at a set of paths in a single forward pass.
+	// Paths are compiled once when added and a query can be run on any number of inputs.
+	// Each value tracks the set of paths it can still lead to, values that lead to none
+	// of them are skipped without being looked into. Nothing is allocated.
+	//
+	// Paths are keys separated by dots with array elements between brackets,
+	// a '*' matches any key or any element, e.g.: clip.tracks[*].name
+	// Matches are reported in input order, a value is reported after the values it contains.
+	//
+	// e.g.:
+	//    PathQuery query;
+	//    const uint32_t name_index = query.add_path("clip.tracks[*].name");
+	//    const uint32_t rate_index = query.add_path("settings.sample_rate");
+	//
+	//    Parser parser(input, input_length);
+	//    query.run(parser, handler);
+	//////////////////////////////////////////////////////////////////////////
+	class PathQuery
+	{
+	public:
+		static constexpr uint32_t k_max_num_paths = 64;
+		static constexpr uint32_t k_max_num_segments = 256;
+
+		// Returned by add_path when a path is malformed or when the query cannot hold it
+		static constexpr uint32_t k_invalid_path_index = ~0U;
+
+		PathQuery()
+			: m_num_paths(0)
+			, m_num_segments(0)
+		{}
+
+		// The path must outlive the query, returns the index reported to the handler on matches.
+		// Malformed paths are not added and k_invalid_path_index is returned, e.g.: clip..name or tracks[x]
+		uint32_t add_path(const char* path)
+		{
+			if (m_num_paths == k_max_num_paths)
+				return k_invalid_path_index;
+
+			const uint32_t num_segments = sjson_impl::compile_path(path, m_segments + m_num_segments, k_max_num_segments - m_num_segments);
+			if (num_segments == 0)
+				return k_invalid_path_index;
+
+			CompiledPath& compiled_path = m_paths[m_num_paths];
+			compiled_path.first_segment = m_num_segments;
+			compiled_path.num_segments = num_segments;
+
+			m_num_segments += num_segments;
+			return m_num_paths++;
+		}
+
+		uint32_t get_num_paths() const { return m_num_paths; }
+
+		// Runs the query on the remainder of the input, returns false if it could not be parsed; the parser then holds the error
+		bool run(Parser& parser, QueryHandler& handler) const
+		{
+			const PathMask all_paths = m_num_paths == k_max_num_paths ? ~PathMask(0) : ((PathMask(1) << m_num_paths) - 1);
+
+			while (true)
+			{
+				if (!parser.skip_comments_and_whitespace())
+					return false;
+
+				if (parser.eof())
+					return true;
+
+				StringView key;
+				if (!parser.read_any_key(key))
+					return false;
+
+				if (!run_value(parser, handler, all_paths, 0, &key, 0))
+					return false;
+			}
+		}
+
+	private:
+		typedef uint64_t PathMask;
+
+		struct CompiledPath
+		{
+			uint32_t first_segment;
+			uint32_t num_segments;
+		};
+
+		CompiledPath m_paths[k_max_num_paths];
+		sjson_impl::PathSegment m_segments[k_max_num_segments];
+		uint32_t m_num_paths;
+		uint32_t m_num_segments;
+
+		// Reads the value of a member when a key is provided or of an array element otherwise.
+		// Only the paths in the mask can still match the value, they all matched its container.
+		bool run_value(Parser& parser, QueryHandler& handler, PathMask paths, uint32_t depth, const StringView* key, size_t index) const
+		{
+			PathMask prefix_paths = 0;
+			PathMask full_paths = 0;
+
+			for (uint32_t path_index = 0; path_index < m_num_paths; ++path_index)
+			{
+				const PathMask path_bit = PathMask(1) << path_index;
+				if ((paths & path_bit) == 0)
+					continue;
+
+				const CompiledPath& path = m_paths[path_index];
+				if (depth >= path.num_segments)
+					continue;
+
+				if (!sjson_impl::match_path_segment(m_segments[path.first_segment + depth], key, index))
+					continue;
+
+				if (depth + 1 == path.num_segments)
+					full_paths |= path_bit;
+				else
+					prefix_paths |= path_bit;
+			}
+
+			if (!parser.skip_comments_and_whitespace_fail_if_eof())
+				return false;
+
+			const size_t value_start = parser.m_state.offset;
+
+			if (prefix_paths == 0)
+			{
+				if (!parser.skip_value())
+					return false;
+			}
+			else if (parser.m_state.symbol == '{')
+			{
+				parser.advance();
+
+				while (!parser.try_object_ends())
+				{
+					StringView member_key;
+					if (!parser.read_any_key(member_key))
+						return false;
+
+					if (!run_value(parser, handler, prefix_paths, depth + 1, &member_key, 0))
+						return false;
+				}
+			}
+			else if (parser.m_state.symbol == '[')
+			{
+				parser.advance();
+
+				if (!parser.try_array_ends())
+				{
+					for (size_t element_index = 0; ; ++element_index)
+					{
+						if (!run_value(parser, handler, prefix_paths, depth + 1, nullptr, element_index))
+							return false;
+
+						if (parser.try_array_ends())
+							break;
+
+						if (!parser.read_comma())
+							return false;
+					}
+				}
+			}
+			else if (!parser.skip_value())
+				return false;
+
+			if (full_paths != 0)
+			{
+				const StringView raw_value(parser.m_input + value_start, parser.m_state.offset - value_start);
+
+				for (uint32_t path_index = 0; path_index < m_num_paths; ++path_index)
+				{
+					if ((full_paths & (PathMask(1) << path_index)) != 0)
+						handler.on_match(path_index, raw_value);
+				}
+			}
+
+			return true;
+		}
+	};
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
@@ -0,0 +1,437 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/parser.h"
+#include "sjson/parser_error.h"
+#include "sjson/string_view.h"
+#include "sjson/version.h"
+#include "sjson/impl/simd.impl.h"
+#include "sjson/impl/text_layout.impl.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace sjson_impl
+	{
+		// Returns the offset of the next character that matters to find where a record ends: braces,
+		// quotation marks, and slashes since they can begin comments. Returns the length if there is none.
+		inline size_t find_record_symbol(const char* input, size_t length, size_t offset)
+		{
+#if defined(SJSON_CPP_IMPL_SSE2_INTRINSICS)
+			const __m128i opening_brace = _mm_set1_epi8('{');
+			const __m128i closing_brace = _mm_set1_epi8('}');
+			const __m128i quotation_mark = _mm_set1_epi8('"');
+			const __m128i slash = _mm_set1_epi8('/');
+
+			for (; offset + 16 <= length; offset += 16)
+			{
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + offset));
+				const __m128i braces = _mm_or_si128(_mm_cmpeq_epi8(chunk, opening_brace), _mm_cmpeq_epi8(chunk, closing_brace));
+				const __m128i others = _mm_or_si128(_mm_cmpeq_epi8(chunk, quotation_mark), _mm_cmpeq_epi8(chunk, slash));
+				const int mask = _mm_movemask_epi8(_mm_or_si128(braces, others));
+				if (mask != 0)
+					return offset + count_trailing_zeros(static_cast<uint32_t>(mask));
+			}
+#elif defined(SJSON_CPP_IMPL_NEON64_INTRINSICS)
+			const uint8x16_t opening_brace = vdupq_n_u8('{');
+			const uint8x16_t closing_brace = vdupq_n_u8('}');
+			const uint8x16_t quotation_mark = vdupq_n_u8('"');
+			const uint8x16_t slash = vdupq_n_u8('/');
+
+			for (; offset + 16 <= length; offset += 16)
+			{
+				const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(input + offset));
+				const uint8x16_t braces = vorrq_u8(vceqq_u8(chunk, opening_brace), vceqq_u8(chunk, closing_brace));
+				const uint8x16_t others = vorrq_u8(vceqq_u8(chunk, quotation_mark), vceqq_u8(chunk, slash));
+				if (vmaxvq_u8(vorrq_u8(braces, others)) != 0)
+					break;	// The scalar loop below finds the exact offset within this chunk
+			}
+#endif
+
+			for (; offset < length; ++offset)
+			{
+				const char symbol = input[offset];
+				if (symbol == '{' || symbol == '}' || symbol == '"' || symbol == '/')
+					return offset;
+			}
+
+			return length;
+		}
+
+		// Moves the offset past the end of the comment that begins there, returns false if a block comment is not terminated.
+		// A line comment can end with the input.
+		inline bool skip_record_comment(const char* input, size_t length, size_t& offset)
+		{
+			if (offset + 1 < length && input[offset + 1] == '/')
+			{
+				offset += 2;
+				while (offset < length && input[offset] != '\n')
+					offset++;
+
+				return true;
+			}
+
+			if (offset + 1 < length && input[offset + 1] == '*')
+			{
+				for (offset += 2; offset + 1 < length; ++offset)
+				{
+					if (input[offset] == '*' && input[offset + 1] == '/')
+					{
+						offset += 2;
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			// Not a comment, the record parser reports it
+			offset++;
+			return true;
+		}
+
+		// Finds the offset past the closing brace that matches the opening brace at the offset,
+		// strings and comments are skipped. Returns false if the record is not terminated.
+		inline bool find_record_end(const char* input, size_t length, size_t offset, size_t& end_offset)
+		{
+			uint32_t depth = 0;
+
+			while (true)
+			{
+				offset = find_record_symbol(input, length, offset);
+				if (offset >= length)
+					return false;
+
+				switch (input[offset])
+				{
+				case '{':
+					depth++;
+					offset++;
+					break;
+				case '}':
+					offset++;
+					if (--depth == 0)
+					{
+						end_offset = offset;
+						return true;
+					}
+					break;
+				case '"':
+					for (offset++; offset < length && input[offset] != '"'; ++offset)
+					{
+						if (input[offset] == '\\')
+							offset++;
+					}
+
+					if (offset >= length)
+						return false;
+
+					offset++;
+					break;
+				default:
+					if (!skip_record_comment(input, length, offset))
+						return false;
+					break;
+				}
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Splits an input made of consecutive top level objects into records, one per object.
+	// Whitespace and comments can separate records.
+	// e.g.: { time = 1.5 event = "jump" } { time = 2.0 event = "land" }
+	//
+	// Records are found with a fast scan that only tracks braces, strings, and comments,
+	// the content of a record is only validated when it is parsed.
+	//////////////////////////////////////////////////////////////////////////
+	class RecordSplitter
+	{
+	public:
+		RecordSplitter(const char* input, size_t input_length)
+			: m_input(input)
+			, m_input_length(input_length)
+			, m_offset(0)
+			, m_error()
+		{
+			// Skip the BOM if present
+			if (input_length >= 3 && input[0] == char(uint8_t(0xEF)) && input[1] == char(uint8_t(0xBB)) && input[2] == char(uint8_t(0xBF)))
+				m_offset = 3;
+		}
+
+		// Returns the raw text of the next record, braces included.
+		// Returns false once every record has been returned or if the input is invalid, see is_valid.
+		bool next_record(StringView& record)
+		{
+			if (!is_valid() || !skip_comments_and_whitespace() || eof())
+				return false;
+
+			if (m_input[m_offset] != '{')
+			{
+				set_error(ParserError::OpeningBraceExpected, m_offset);
+				return false;
+			}
+
+			size_t end_offset;
+			if (!sjson_impl::find_record_end(m_input, m_input_length, m_offset, end_offset))
+			{
+				set_error(ParserError::InputTruncated, m_offset);
+				return false;
+			}
+
+			record = StringView(m_input + m_offset, end_offset - m_offset);
+			m_offset = end_offset;
+			return true;
+		}
+
+		bool eof() const { return m_offset >= m_input_length; }
+
+		// The offset in the input of the next record, or of where splitting failed
+		size_t get_offset() const { return m_offset; }
+
+		// The position of errors is the beginning of the record that could not be split
+		ParserError get_error() const { return m_error; }
+		bool is_valid() const { return m_error.error == ParserError::None; }
+
+	private:
+		const char* m_input;
+		size_t m_input_length;
+		size_t m_offset;
+		ParserError m_error;
+
+		bool skip_comments_and_whitespace()
+		{
+			while (m_offset < m_input_length)
+			{
+				const char symbol = m_input[m_offset];
+				if (sjson_impl::is_whitespace(symbol))
+				{
+					m_offset++;
+				}
+				else if (symbol == '/')
+				{
+					if (m_offset + 1 >= m_input_length || (m_input[m_offset + 1] != '/' && m_input[m_offset + 1] != '*'))
+					{
+						set_error(ParserError::CommentBeginsIncorrectly, m_offset);
+						return false;
+					}
+
+					const size_t comment_offset = m_offset;
+					if (!sjson_impl::skip_record_comment(m_input, m_input_length, m_offset))
+					{
+						m_offset = comment_offset;
+						set_error(ParserError::InputTruncated, comment_offset);
+						return false;
+					}
+				}
+				else
+					break;
+			}
+
+			return true;
+		}
+
+		void set_error(uint32_t error, size_t offset)
+		{
+			m_error.error = error;
+			sjson_impl::get_line_and_column(m_input, m_input_length, offset, m_error.line, m_error.column);
+		}
+	};
+
+	class RecordHandler
+	{
+	public:
+		virtual ~RecordHandler() = default;
+
+		// Called once per record with a parser over the members of the record, they are read like the root of a document.
+		// The index is the position of the record in the input. Returning false stops reading and reports the parser error.
+		// With a ParallelRecordReader, it is called concurrently from several threads and must not throw.
+		virtual bool on_record(size_t record_index, Parser& parser) = 0;
+	};
+
+	// Why reading records stopped, see for_each_record
+	struct RecordError
+	{
+		// The error of the record parser or of the splitter, positions in record errors are relative to the record
+		ParserError error;
+
+		// The index of the record that failed or that could not be split
+		size_t record_index = 0;
+
+		// The offset of that record in the input
+		size_t record_offset = 0;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Reads every record on the calling thread in input order, see RecordSplitter.
+	// Returns false if the input could not be split or if a record could not be read.
+	//
+	// e.g.:
+	//    RecordError error;
+	//    if (!for_each_record(input, input_length, handler, error))
+	//        printf("%s in record %zu\n", error.error.get_description(), error.record_index);
+	//////////////////////////////////////////////////////////////////////////
+	inline bool for_each_record(const char* input, size_t input_length, RecordHandler& handler, RecordError& error)
+	{
+		RecordSplitter splitter(input, input_length);
+
+		StringView record;
+		size_t record_index = 0;
+		for (; splitter.next_record(record); ++record_index)
+		{
+			Parser parser(record.c_str() + 1, record.size() - 2);
+			if (!handler.on_record(record_index, parser))
+			{
+				error.error = parser.get_error();
+				error.record_index = record_index;
+				error.record_offset = static_cast<size_t>(record.c_str() - input);
+				return false;
+			}
+		}
+
+		error.error = splitter.get_error();
+		error.record_index = record_index;
+		error.record_offset = splitter.get_offset();
+		return splitter.is_valid();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Reads the records on threads provided by the caller, the library does not start any.
+	// Every thread that takes part calls run(), e.g. from the jobs of a job system, and the
+	// result is available once every call returned.
+	//
+	// Records are handed out in input order but complete in any order, splitting is much cheaper
+	// than parsing and happens under a lock. Once a record fails no other record is handed out
+	// and the error reported is the one of the first failed record in input order.
+	//////////////////////////////////////////////////////////////////////////
+	class ParallelRecordReader
+	{
+	public:
+		ParallelRecordReader(const char* input, size_t input_length, RecordHandler& handler)
+			: m_input(input)
+			, m_splitter(input, input_length)
+			, m_handler(handler)
+			, m_next_record_index(0)
+			, m_error()
+			, m_has_failed(false)
+		{
+			m_error.record_index = std::numeric_limits<size_t>::max();
+		}
+
+		ParallelRecordReader(const ParallelRecordReader&) = delete;
+		ParallelRecordReader& operator=(const ParallelRecordReader&) = delete;
+
+		// Reads records until none are left or one failed
+		void run()
+		{
+			while (true)
+			{
+				StringView record;
+				size_t record_index;
+
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					if (m_has_failed)
+						return;
+
+					if (!m_splitter.next_record(record))
+					{
+						if (!m_splitter.is_valid())
+							fail(m_next_record_index, m_splitter.get_offset(), m_splitter.get_error());
+
+						return;
+					}
+
+					record_index = m_next_record_index++;
+				}
+
+				Parser parser(record.c_str() + 1, record.size() - 2);
+				if (!m_handler.on_record(record_index, parser))
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					fail(record_index, static_cast<size_t>(record.c_str() - m_input), parser.get_error());
+					return;
+				}
+			}
+		}
+
+		bool is_valid() const { return !m_has_failed; }
+		RecordError get_error() const { return m_has_failed ? m_error : RecordError(); }
+
+	private:
+		std::mutex m_mutex;
+		const char* m_input;
+		RecordSplitter m_splitter;
+		RecordHandler& m_handler;
+		size_t m_next_record_index;
+
+		// The first failure in input order wins, records that were already handed out still complete
+		RecordError m_error;
+		bool m_has_failed;
+
+		void fail(size_t record_index, size_t record_offset, const ParserError& error)
+		{
+			m_has_failed = true;
+
+			if (record_index < m_error.record_index)
+			{
+				m_error.error = error;
+				m_error.record_index = record_index;
+				m_error.record_offset = record_offset;
+			}
+		}
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Reads the records with a ParallelRecordReader, see for_each_record.
+	// The executor is called once with a function that it must call from every thread that takes part,
+	// the calling thread included if it wants, and it must return once all of those calls returned.
+	//
+	// e.g.:
+	//    RecordError error;
+	//    parallel_for_each_record(input, input_length, handler, [](const std::function<void()>& read_records)
+	//        {
+	//            job_system.run_on_all_workers(read_records);
+	//        }, error);
+	//////////////////////////////////////////////////////////////////////////
+	template<typename ExecutorFunType>
+	inline bool parallel_for_each_record(const char* input, size_t input_length, RecordHandler& handler, ExecutorFunType executor, RecordError& error)
+	{
+		ParallelRecordReader reader(input, input_length, handler);
+		executor([&reader]() { reader.run(); });
+
+		error = reader.get_error();
+		return reader.is_valid();
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
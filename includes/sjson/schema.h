@@ -0,0 +1,491 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/error.h"
+#include "sjson/key.h"
+#include "sjson/parser.h"
+#include "sjson/parser_error.h"
+#include "sjson/string_view.h"
+#include "sjson/version.h"
+#include "sjson/writer.h"
+
+#include <cinttypes>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Describes how a member of a struct maps to a key, see schema_field.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename StructType, typename MemberType>
+	struct SchemaField
+	{
+		typedef StructType struct_type;
+		typedef MemberType member_type;
+
+		Key key;
+		MemberType StructType::* member;
+		MemberType default_value;
+		bool is_optional;
+	};
+
+	// A required field, reading fails if its key is missing
+	template<typename StructType, typename MemberType>
+	inline SchemaField<StructType, MemberType> schema_field(const Key& key, MemberType StructType::* member)
+	{
+		return SchemaField<StructType, MemberType>{ key, member, MemberType(), false };
+	}
+
+	// An optional field, the default value is used when its key is missing or its value is null
+	template<typename StructType, typename MemberType, typename DefaultType>
+	inline SchemaField<StructType, MemberType> schema_field(const Key& key, MemberType StructType::* member, const DefaultType& default_value)
+	{
+		return SchemaField<StructType, MemberType>{ key, member, MemberType(default_value), true };
+	}
+
+	namespace sjson_impl
+	{
+		template<size_t... Indices>
+		struct IndexSequence {};
+
+		template<size_t Count, size_t... Indices>
+		struct MakeIndexSequence : MakeIndexSequence<Count - 1, Count - 1, Indices...> {};
+
+		template<size_t... Indices>
+		struct MakeIndexSequence<0, Indices...> { typedef IndexSequence<Indices...> type; };
+
+		constexpr uint32_t next_power_of_two(uint32_t value, uint32_t power = 1)
+		{
+			return power >= value ? power : next_power_of_two(value, power * 2);
+		}
+
+		constexpr uint32_t log2_power_of_two(uint32_t value)
+		{
+			return value <= 1 ? 0 : 1 + log2_power_of_two(value / 2);
+		}
+
+		// Member prefixes are precomputed for indentation levels up to this value
+		constexpr uint32_t k_max_schema_fragment_indent = 8;
+
+		// Keys longer than this once quoted are written the regular way
+		constexpr size_t k_max_schema_fragment_key_size = 64;
+
+		constexpr size_t k_schema_fragment_capacity = k_max_schema_fragment_indent + k_max_schema_fragment_key_size + 3;
+
+		// Writes members with a precomputed prefix, it has access to the writer internals
+		struct SchemaWriter
+		{
+			// Builds the prefix of a member: indentation, the key, and the equal sign. Returns its size or 0 if it does not fit.
+			static size_t build_fragment(const Key& key, char (&fragment)[k_schema_fragment_capacity])
+			{
+				const KeyView key_view(key.c_str(), key.size());
+
+				CountingStreamWriter counting_writer;
+				write_key(counting_writer, key_view);
+				if (counting_writer.get_size() > k_max_schema_fragment_key_size)
+					return 0;
+
+				for (uint32_t level = 0; level < k_max_schema_fragment_indent; ++level)
+					fragment[level] = '\t';
+
+				BufferStreamWriter buffer_writer(fragment + k_max_schema_fragment_indent, k_max_schema_fragment_key_size + 3);
+				write_key(buffer_writer, key_view);
+				buffer_writer.write(" = ", 3);
+				return buffer_writer.get_size() + k_max_schema_fragment_indent;
+			}
+
+			// Writes the prefix of a member in a single write, returns false if the fragment cannot be used
+			static bool write_fragment(ObjectWriter& writer, const char* fragment, size_t fragment_size)
+			{
+				SJSON_CPP_ASSERT(!writer.m_is_locked, "Cannot insert SJSON value in locked object");
+				SJSON_CPP_ASSERT(!writer.m_has_live_value_ref, "Cannot insert SJSON value in object when it has a live ValueRef");
+
+				if (fragment_size == 0 || writer.m_indent_level > k_max_schema_fragment_indent)
+					return false;
+
+				const size_t skipped_indent = k_max_schema_fragment_indent - writer.m_indent_level;
+				writer.m_stream_writer.write(fragment + skipped_indent, fragment_size - skipped_indent);
+				return true;
+			}
+
+			static void write_value(ObjectWriter& writer, const StringView& value)
+			{
+				write_quoted_string(writer.m_stream_writer, value.c_str(), value.size());
+				writer.m_stream_writer.write(k_line_terminator);
+			}
+
+			static void write_value(ObjectWriter& writer, bool value)
+			{
+				char buffer[16];
+				const int length = snprintf(buffer, sizeof(buffer), "%s%s", value ? "true" : "false", k_line_terminator);
+				writer.m_stream_writer.write(buffer, static_cast<size_t>(length));
+			}
+
+			static void write_value(ObjectWriter& writer, double value)
+			{
+				write_double(writer.m_stream_writer, value, writer.m_float_format);
+				writer.m_stream_writer.write(k_line_terminator);
+			}
+
+			static void write_value(ObjectWriter& writer, float value) { write_value(writer, double(value)); }
+
+			template<typename IntegralType, typename std::enable_if<std::is_integral<IntegralType>::value && std::is_signed<IntegralType>::value>::type* = nullptr>
+			static void write_value(ObjectWriter& writer, IntegralType value)
+			{
+				char buffer[32];
+				const int length = snprintf(buffer, sizeof(buffer), "%" PRId64 "%s", int64_t(value), k_line_terminator);
+				writer.m_stream_writer.write(buffer, static_cast<size_t>(length));
+			}
+
+			template<typename IntegralType, typename std::enable_if<std::is_integral<IntegralType>::value && std::is_unsigned<IntegralType>::value>::type* = nullptr>
+			static void write_value(ObjectWriter& writer, IntegralType value)
+			{
+				char buffer[32];
+				const int length = snprintf(buffer, sizeof(buffer), "%" PRIu64 "%s", uint64_t(value), k_line_terminator);
+				writer.m_stream_writer.write(buffer, static_cast<size_t>(length));
+			}
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// A Schema binds the members of a struct to keys, it reads objects into the struct and writes it back.
+	//
+	// Reading is done in a single pass.
+	// Keys can appear in any order: each key found is dispatched through a perfect hash table
+	// to the typed read of its member. Unknown keys are skipped and missing optional members
+	// are set to their default value without any backtracking.
+	//
+	// Writing emits every member in declaration order. The indentation, the key, and the
+	// equal sign of each member are precomputed as a single fragment: writing a member
+	// is one copy of its fragment followed by its formatted value.
+	//
+	// The perfect hash table and the fragments are built when the schema is constructed,
+	// construct it once and reuse it. Should no perfect hash table exist, e.g.: when two keys
+	// have the same hash, keys are compared with every field instead.
+	// Every field must use a different key, reading with a schema that does not always fails
+	// with ParserError::DuplicateSchemaKey.
+	// Members can be: bool, float, double, integral types, and StringView.
+	//
+	// e.g.:
+	//    struct Clip { StringView name; uint32_t sample_rate; float duration; };
+	//
+	//    static const auto k_clip_schema = make_schema(
+	//        schema_field("name", &Clip::name),
+	//        schema_field("sample_rate", &Clip::sample_rate, 30),
+	//        schema_field("duration", &Clip::duration, 0.0F));
+	//
+	//    Clip clip;
+	//    k_clip_schema.read(parser, "clip", clip);
+	//    k_clip_schema.write(writer, "clip", clip);
+	//////////////////////////////////////////////////////////////////////////
+	template<typename StructType, typename... FieldTypes>
+	class Schema
+	{
+	public:
+		static constexpr uint32_t k_num_fields = uint32_t(sizeof...(FieldTypes));
+		static constexpr uint32_t k_max_num_fields = 32;
+
+		static_assert(k_num_fields != 0, "A schema requires at least one field");
+		static_assert(k_num_fields <= k_max_num_fields, "Too many schema fields");
+
+		explicit Schema(const FieldTypes&... fields)
+			: m_fields(fields...)
+			, m_multiplier(0)
+			, m_is_hash_table_perfect(false)
+			, m_has_duplicate_keys(false)
+		{
+			init_keys(typename sjson_impl::MakeIndexSequence<sizeof...(FieldTypes)>::type());
+
+			for (uint32_t field_index = 0; field_index < k_num_fields; ++field_index)
+			{
+				for (uint32_t other_field_index = field_index + 1; other_field_index < k_num_fields; ++other_field_index)
+				{
+					if (is_key_equal(m_keys[field_index], m_keys[other_field_index]))
+						m_has_duplicate_keys = true;
+				}
+			}
+
+			SJSON_CPP_ASSERT(!m_has_duplicate_keys, "Two schema fields use the same key");
+			build_hash_table();
+		}
+
+		// Writes an object: key = { ... }
+		void write(ObjectWriter& writer, const KeyView& key, const StructType& value) const
+		{
+			writer.insert(key, [&](ObjectWriter& object_writer) { write_members(object_writer, value); });
+		}
+
+		// Writes the members of the struct into an existing object, e.g.: the root object
+		void write_members(ObjectWriter& writer, const StructType& value) const
+		{
+			write_fields(writer, value, typename sjson_impl::MakeIndexSequence<sizeof...(FieldTypes)>::type());
+		}
+
+		// Reads an object: key = { ... }
+		bool read(Parser& parser, const Key& key, StructType& value) const
+		{
+			return parser.object_begins(key) && read_members(parser, value, false);
+		}
+
+		// Reads the members of the root object until the end of the input
+		bool read_root(Parser& parser, StructType& value) const
+		{
+			return read_members(parser, value, true);
+		}
+
+	private:
+		// A load factor of at most 1/N keeps the expected number of attempts to find a perfect hash low
+		static constexpr uint32_t k_num_slots = sjson_impl::next_power_of_two(k_num_fields * k_num_fields * 2);
+		static constexpr uint32_t k_slot_shift = 32 - sjson_impl::log2_power_of_two(k_num_slots);
+		static constexpr uint32_t k_invalid_field = ~0U;
+		static constexpr uint32_t k_max_hash_table_attempts = 10000;
+
+		typedef bool (Schema::*ReadFunction)(Parser&, StructType&) const;
+		typedef bool (Schema::*DefaultFunction)(StructType&) const;
+
+		struct KeyEntry
+		{
+			const char* c_str;
+			size_t length;
+			uint32_t hash;
+		};
+
+		std::tuple<FieldTypes...> m_fields;
+		KeyEntry m_keys[sizeof...(FieldTypes)];
+
+		char m_fragments[sizeof...(FieldTypes)][sjson_impl::k_schema_fragment_capacity];
+		size_t m_fragment_sizes[sizeof...(FieldTypes)];
+
+		// Field index + 1 for each slot, 0 when empty
+		uint8_t m_slots[k_num_slots];
+		uint32_t m_multiplier;
+		bool m_is_hash_table_perfect;
+		bool m_has_duplicate_keys;
+
+		template<size_t... Indices>
+		void init_keys(sjson_impl::IndexSequence<Indices...>)
+		{
+			const Key* keys[] = { &std::get<Indices>(m_fields).key... };
+
+			for (uint32_t field_index = 0; field_index < k_num_fields; ++field_index)
+			{
+				m_keys[field_index].c_str = keys[field_index]->c_str();
+				m_keys[field_index].length = keys[field_index]->size();
+				m_keys[field_index].hash = keys[field_index]->get_hash();
+				m_fragment_sizes[field_index] = sjson_impl::SchemaWriter::build_fragment(*keys[field_index], m_fragments[field_index]);
+			}
+		}
+
+		static bool is_key_equal(const KeyEntry& entry, const KeyEntry& other)
+		{
+			return entry.hash == other.hash && entry.length == other.length && std::memcmp(entry.c_str, other.c_str, entry.length) == 0;
+		}
+
+		// Leaves m_is_hash_table_perfect false when no multiplier spreads the keys, find_field then compares every key
+		void build_hash_table()
+		{
+			if (m_has_duplicate_keys)
+				return;
+
+			for (uint32_t attempt = 0; attempt < k_max_hash_table_attempts && !m_is_hash_table_perfect; ++attempt)
+			{
+				// Odd multipliers derived from the golden ratio
+				m_multiplier = 0x9E3779B9U + attempt * 2;
+
+				for (uint32_t slot_index = 0; slot_index < k_num_slots; ++slot_index)
+					m_slots[slot_index] = 0;
+
+				bool is_perfect = true;
+				for (uint32_t field_index = 0; field_index < k_num_fields && is_perfect; ++field_index)
+				{
+					const uint32_t slot_index = get_slot(m_keys[field_index].hash);
+					is_perfect = m_slots[slot_index] == 0;
+					m_slots[slot_index] = uint8_t(field_index + 1);
+				}
+
+				m_is_hash_table_perfect = is_perfect;
+			}
+		}
+
+		uint32_t get_slot(uint32_t hash) const { return (hash * m_multiplier) >> k_slot_shift; }
+
+		uint32_t find_field(const StringView& key, uint32_t hash) const
+		{
+			if (!m_is_hash_table_perfect)
+			{
+				for (uint32_t field_index = 0; field_index < k_num_fields; ++field_index)
+				{
+					const KeyEntry& entry = m_keys[field_index];
+					if (entry.hash == hash && entry.length == key.size() && std::memcmp(entry.c_str, key.c_str(), key.size()) == 0)
+						return field_index;
+				}
+
+				return k_invalid_field;
+			}
+
+			const uint32_t slot_value = m_slots[get_slot(hash)];
+			if (slot_value == 0)
+				return k_invalid_field;
+
+			const uint32_t field_index = slot_value - 1;
+			const KeyEntry& entry = m_keys[field_index];
+			if (entry.hash != hash || entry.length != key.size() || std::memcmp(entry.c_str, key.c_str(), key.size()) != 0)
+				return k_invalid_field;
+
+			return field_index;
+		}
+
+		bool read_members(Parser& parser, StructType& value, bool is_root) const
+		{
+			if (m_has_duplicate_keys)
+			{
+				sjson_impl::ParserAccess::set_error(parser, ParserError::DuplicateSchemaKey);
+				return false;
+			}
+
+			uint32_t found_fields = 0;
+
+			while (true)
+			{
+				if (is_root)
+				{
+					if (!parser.skip_comments_and_whitespace())
+						return false;
+
+					if (parser.eof())
+						break;
+				}
+				else if (parser.try_object_ends())
+					break;
+
+				StringView key;
+				uint32_t hash;
+				if (!sjson_impl::ParserAccess::read_any_key(parser, key, hash))
+					return false;
+
+				const uint32_t field_index = find_field(key, hash);
+				if (field_index == k_invalid_field)
+				{
+					if (!parser.skip_value())
+						return false;
+
+					continue;
+				}
+
+				if (!read_field(field_index, parser, value, typename sjson_impl::MakeIndexSequence<sizeof...(FieldTypes)>::type()))
+					return false;
+
+				found_fields |= 1U << field_index;
+			}
+
+			for (uint32_t field_index = 0; field_index < k_num_fields; ++field_index)
+			{
+				if ((found_fields & (1U << field_index)) != 0)
+					continue;
+
+				if (!apply_default(field_index, value, typename sjson_impl::MakeIndexSequence<sizeof...(FieldTypes)>::type()))
+				{
+					sjson_impl::ParserAccess::set_error(parser, ParserError::RequiredKeyMissing);
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		template<size_t... Indices>
+		bool read_field(uint32_t field_index, Parser& parser, StructType& value, sjson_impl::IndexSequence<Indices...>) const
+		{
+			static const ReadFunction k_read_functions[] = { &Schema::read_field_at<Indices>... };
+			return (this->*k_read_functions[field_index])(parser, value);
+		}
+
+		template<size_t... Indices>
+		bool apply_default(uint32_t field_index, StructType& value, sjson_impl::IndexSequence<Indices...>) const
+		{
+			static const DefaultFunction k_default_functions[] = { &Schema::apply_default_at<Indices>... };
+			return (this->*k_default_functions[field_index])(value);
+		}
+
+		template<size_t Index>
+		bool read_field_at(Parser& parser, StructType& value) const
+		{
+			const auto& field = std::get<Index>(m_fields);
+
+			if (field.is_optional && sjson_impl::ParserAccess::try_read_null(parser))
+			{
+				value.*field.member = field.default_value;
+				return true;
+			}
+
+			return sjson_impl::ParserAccess::read_value(parser, value.*field.member);
+		}
+
+		template<size_t... Indices>
+		void write_fields(ObjectWriter& writer, const StructType& value, sjson_impl::IndexSequence<Indices...>) const
+		{
+			const int expansion[] = { (write_field_at<Indices>(writer, value), 0)... };
+			(void)expansion;
+		}
+
+		template<size_t Index>
+		void write_field_at(ObjectWriter& writer, const StructType& value) const
+		{
+			const auto& field = std::get<Index>(m_fields);
+
+			if (sjson_impl::SchemaWriter::write_fragment(writer, m_fragments[Index], m_fragment_sizes[Index]))
+				sjson_impl::SchemaWriter::write_value(writer, value.*field.member);
+			else
+				writer.insert(field.key, value.*field.member);
+		}
+
+		template<size_t Index>
+		bool apply_default_at(StructType& value) const
+		{
+			const auto& field = std::get<Index>(m_fields);
+			if (!field.is_optional)
+				return false;
+
+			value.*field.member = field.default_value;
+			return true;
+		}
+	};
+
+	// The struct type is deduced from the fields, they must all belong to the same struct
+	template<typename FirstFieldType, typename... FieldTypes>
+	inline Schema<typename FirstFieldType::struct_type, FirstFieldType, FieldTypes...> make_schema(const FirstFieldType& first_field, const FieldTypes&... fields)
+	{
+		return Schema<typename FirstFieldType::struct_type, FirstFieldType, FieldTypes...>(first_field, fields...);
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
@@ -0,0 +1,414 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sjson/error.h"
+#include "sjson/parser.h"
+#include "sjson/parser_error.h"
+#include "sjson/string_view.h"
+#include "sjson/version.h"
+#include "sjson/writer.h"
+#include "sjson/impl/path.impl.h"
+#include "sjson/impl/text_layout.impl.h"
+
+#include <cstdint>
+
+namespace sjson
+{
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_BEGIN
+
+	class StreamTransform;
+
+	//////////////////////////////////////////////////////////////////////////
+	// The value a TransformHandler is called with along with the edits it can make.
+	// A value is kept as-is unless it is dropped or replaced, a member can also be renamed.
+	// A member must be renamed before its value is replaced, and a value cannot be
+	// dropped once it has been renamed or replaced.
+	//////////////////////////////////////////////////////////////////////////
+	class TransformContext
+	{
+	public:
+		// The key of the member, empty for array elements
+		StringView get_key() const { return m_key; }
+
+		// The raw input text of the value, e.g.: [ 1, 2 ] or "some \"text\""
+		// It can be read with a Parser of its own.
+		StringView get_raw_value() const { return m_raw_value; }
+
+		bool is_array_element() const { return !m_is_member; }
+
+		// Removes the value, members are removed along with their key, and with their line and a comment that ends it if nothing else is on it
+		void drop();
+
+		// Writes a different key for the member
+		void rename(const KeyView& key);
+
+		// Writes a different value, the value can be anything that ArrayWriter::push accepts
+		template<typename T>
+		void replace(const T& value);
+
+	private:
+		TransformContext(StreamTransform& transform, const StringView* key, size_t key_start, size_t key_end, size_t value_start, size_t value_end);
+
+		TransformContext(const TransformContext&) = delete;
+		TransformContext& operator=(const TransformContext&) = delete;
+
+		StreamTransform& m_transform;
+		StringView m_key;
+		StringView m_raw_value;
+		size_t m_key_start;
+		size_t m_key_end;
+		size_t m_value_start;
+		size_t m_value_end;
+		bool m_is_member;
+		bool m_is_dropped;
+		bool m_is_renamed;
+		bool m_is_replaced;
+
+		friend StreamTransform;
+	};
+
+	class TransformHandler
+	{
+	public:
+		virtual ~TransformHandler() = default;
+
+		virtual void transform(TransformContext& context) = 0;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A StreamTransform copies the SJSON input of a parser to a StreamWriter and lets handlers
+	// rewrite or drop the values found at specific paths. Everything else is copied verbatim as
+	// raw input spans, comments and formatting included, numbers are never converted and
+	// subtrees that no handler path can reach are skipped without being looked into.
+	// Memory usage is constant: nothing is allocated and the output is streamed.
+	//
+	// Paths are keys separated by dots with array elements between brackets,
+	// a '*' matches any key or any element, e.g.: clip.tracks[*].name
+	// Paths are compiled once when handlers are added. When several handlers match a value, the first one registered is used.
+	//
+	// e.g.:
+	//    struct RenameHandler final : TransformHandler
+	//    {
+	//        virtual void transform(TransformContext& context) override { context.rename("sample_rate"); }
+	//    };
+	//
+	//    RenameHandler rename_handler;
+	//    StreamTransform transform(parser, file_stream_writer);
+	//    transform.add_handler("clip.rate", rename_handler);
+	//    transform.run();
+	//////////////////////////////////////////////////////////////////////////
+	class StreamTransform
+	{
+	public:
+		static constexpr uint32_t k_max_num_handlers = 32;
+		static constexpr uint32_t k_max_num_segments = 256;
+
+		StreamTransform(Parser& parser, StreamWriter& output, FloatFormat float_format = FloatFormat::Decimal)
+			: m_parser(parser)
+			, m_output(output)
+			, m_float_format(float_format)
+			, m_input(parser.m_input)
+			, m_input_length(parser.m_input_length)
+			, m_copied_offset(parser.m_state.offset)
+			, m_num_handlers(0)
+			, m_num_segments(0)
+		{}
+
+		StreamTransform(const StreamTransform&) = delete;
+		StreamTransform& operator=(const StreamTransform&) = delete;
+
+		// The path and the handler must outlive the transform.
+		// Returns false if the path is malformed or if the transform cannot hold it, e.g.: clip..name or tracks[x]
+		bool add_handler(const char* path, TransformHandler& handler)
+		{
+			if (m_num_handlers == k_max_num_handlers)
+				return false;
+
+			const uint32_t num_segments = sjson_impl::compile_path(path, m_segments + m_num_segments, k_max_num_segments - m_num_segments);
+			if (num_segments == 0)
+				return false;
+
+			HandlerEntry& entry = m_handlers[m_num_handlers];
+			entry.handler = &handler;
+			entry.first_segment = m_num_segments;
+			entry.num_segments = num_segments;
+
+			m_num_segments += num_segments;
+			m_num_handlers++;
+			return true;
+		}
+
+		// Transforms the remainder of the input, returns false if it could not be parsed; the parser then holds the error
+		bool run()
+		{
+			const HandlerMask all_handlers = m_num_handlers == k_max_num_handlers ? ~HandlerMask(0) : ((HandlerMask(1) << m_num_handlers) - 1);
+			if (!transform_members(true, all_handlers, 0))
+				return false;
+
+			copy_until(m_input_length);
+			return true;
+		}
+
+	private:
+		typedef uint32_t HandlerMask;
+
+		struct HandlerEntry
+		{
+			TransformHandler* handler;
+			uint32_t first_segment;
+			uint32_t num_segments;
+		};
+
+		Parser& m_parser;
+		StreamWriter& m_output;
+		FloatFormat m_float_format;
+		const char* m_input;
+		size_t m_input_length;
+		size_t m_copied_offset;
+
+		HandlerEntry m_handlers[k_max_num_handlers];
+		sjson_impl::PathSegment m_segments[k_max_num_segments];
+		uint32_t m_num_handlers;
+		uint32_t m_num_segments;
+
+		// Only the handlers in the mask can still match the values, they all matched their container
+		bool transform_members(bool is_root, HandlerMask handlers, uint32_t depth)
+		{
+			while (true)
+			{
+				if (is_root)
+				{
+					if (!m_parser.skip_comments_and_whitespace())
+						return false;
+
+					if (m_parser.eof())
+						return true;
+				}
+				else if (m_parser.try_object_ends())
+					return true;
+
+				if (!m_parser.skip_comments_and_whitespace_fail_if_eof())
+					return false;
+
+				const size_t key_start = m_parser.m_state.offset;
+				const bool is_quoted = m_parser.m_state.symbol == '"';
+
+				StringView key;
+				if (!m_parser.read_any_key(key))
+					return false;
+
+				const size_t key_end = size_t(key.c_str() - m_input) + key.size() + (is_quoted ? 1 : 0);
+
+				if (!m_parser.skip_comments_and_whitespace_fail_if_eof())
+					return false;
+
+				bool is_dropped;
+				if (!transform_value(&key, 0, handlers, depth, key_start, key_end, is_dropped))
+					return false;
+
+				if (is_dropped)
+				{
+					const size_t value_end = m_parser.m_state.offset;
+					const size_t line_start_offset = sjson_impl::find_line_start(m_input, key_start);
+					const size_t line_end_offset = sjson_impl::find_line_end(m_input, m_input_length, value_end);
+
+					const bool is_whole_line = line_start_offset != sjson_impl::k_invalid_offset && line_end_offset != sjson_impl::k_invalid_offset && line_start_offset >= m_copied_offset;
+					copy_until(is_whole_line ? line_start_offset : key_start);
+					m_copied_offset = is_whole_line ? line_end_offset : value_end;
+				}
+			}
+		}
+
+		bool transform_elements(HandlerMask handlers, uint32_t depth)
+		{
+			if (m_parser.try_array_ends())
+				return true;
+
+			bool has_kept_element = false;
+			size_t previous_element_end = 0;
+
+			for (size_t index = 0; ; ++index)
+			{
+				if (!m_parser.skip_comments_and_whitespace_fail_if_eof())
+					return false;
+
+				const size_t value_start = m_parser.m_state.offset;
+
+				bool is_dropped;
+				if (!transform_value(nullptr, index, handlers, depth, value_start, value_start, is_dropped))
+					return false;
+
+				const size_t value_end = m_parser.m_state.offset;
+
+				if (is_dropped && has_kept_element)
+				{
+					// Drop the separator that precedes the value, the next one is kept
+					copy_until(previous_element_end);
+					m_copied_offset = value_end;
+				}
+				else if (is_dropped)
+				{
+					copy_until(value_start);
+					m_copied_offset = value_end;
+				}
+				else
+				{
+					has_kept_element = true;
+					previous_element_end = value_end;
+				}
+
+				if (m_parser.try_array_ends())
+					return true;
+
+				if (!m_parser.read_comma())
+					return false;
+
+				if (is_dropped && !has_kept_element)
+				{
+					// Nothing precedes the next value, drop the separator that follows this one
+					if (!m_parser.skip_comments_and_whitespace_fail_if_eof())
+						return false;
+
+					m_copied_offset = m_parser.m_state.offset;
+				}
+			}
+		}
+
+		// Transforms the value of a member when a key is provided or of an array element otherwise.
+		// The parser is positioned at the start of the value and is left at its end.
+		bool transform_value(const StringView* key, size_t index, HandlerMask handlers, uint32_t depth, size_t key_start, size_t key_end, bool& is_dropped)
+		{
+			is_dropped = false;
+
+			TransformHandler* handler = nullptr;
+			HandlerMask prefix_handlers = 0;
+			for (uint32_t handler_index = 0; handler_index < m_num_handlers && handler == nullptr; ++handler_index)
+			{
+				const HandlerMask handler_bit = HandlerMask(1) << handler_index;
+				if ((handlers & handler_bit) == 0)
+					continue;
+
+				const HandlerEntry& entry = m_handlers[handler_index];
+				if (!sjson_impl::match_path_segment(m_segments[entry.first_segment + depth], key, index))
+					continue;
+
+				if (depth + 1 == entry.num_segments)
+					handler = entry.handler;
+				else
+					prefix_handlers |= handler_bit;
+			}
+
+			const size_t value_start = m_parser.m_state.offset;
+			bool is_valid;
+
+			if (handler != nullptr)
+			{
+				is_valid = m_parser.skip_value();
+				if (is_valid)
+				{
+					TransformContext context(*this, key, key_start, key_end, value_start, m_parser.m_state.offset);
+					handler->transform(context);
+
+					is_dropped = context.m_is_dropped;
+					if (context.m_is_replaced)
+						m_copied_offset = context.m_value_end;
+				}
+			}
+			else if (prefix_handlers != 0 && m_parser.m_state.symbol == '{')
+			{
+				m_parser.advance();
+				is_valid = transform_members(false, prefix_handlers, depth + 1);
+			}
+			else if (prefix_handlers != 0 && m_parser.m_state.symbol == '[')
+			{
+				m_parser.advance();
+				is_valid = transform_elements(prefix_handlers, depth + 1);
+			}
+			else
+				is_valid = m_parser.skip_value();
+
+			return is_valid;
+		}
+
+		void copy_until(size_t offset)
+		{
+			if (offset > m_copied_offset)
+				m_output.write(m_input + m_copied_offset, offset - m_copied_offset);
+
+			m_copied_offset = offset;
+		}
+
+		friend TransformContext;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline TransformContext::TransformContext(StreamTransform& transform, const StringView* key, size_t key_start, size_t key_end, size_t value_start, size_t value_end)
+		: m_transform(transform)
+		, m_key(key != nullptr ? *key : StringView())
+		, m_raw_value(transform.m_input + value_start, value_end - value_start)
+		, m_key_start(key_start)
+		, m_key_end(key_end)
+		, m_value_start(value_start)
+		, m_value_end(value_end)
+		, m_is_member(key != nullptr)
+		, m_is_dropped(false)
+		, m_is_renamed(false)
+		, m_is_replaced(false)
+	{}
+
+	inline void TransformContext::drop()
+	{
+		SJSON_CPP_ASSERT(!m_is_renamed && !m_is_replaced, "Cannot drop a value that was renamed or replaced");
+		m_is_dropped = true;
+	}
+
+	inline void TransformContext::rename(const KeyView& key)
+	{
+		SJSON_CPP_ASSERT(m_is_member, "Cannot rename an array element");
+		SJSON_CPP_ASSERT(!m_is_dropped && !m_is_renamed && !m_is_replaced, "Cannot rename a value that was dropped, renamed, or replaced");
+
+		m_transform.copy_until(m_key_start);
+		sjson_impl::write_key(m_transform.m_output, key);
+		m_transform.m_copied_offset = m_key_end;
+		m_is_renamed = true;
+	}
+
+	template<typename T>
+	inline void TransformContext::replace(const T& value)
+	{
+		SJSON_CPP_ASSERT(!m_is_dropped && !m_is_replaced, "Cannot replace a value that was dropped or replaced");
+
+		m_transform.copy_until(m_value_start);
+
+		const uint32_t indent_level = sjson_impl::get_indent_level(m_transform.m_input, m_transform.m_input_length, m_key_start);
+		sjson_impl::ValueTokenWriter value_writer(m_transform.m_output, indent_level, m_transform.m_float_format);
+		value_writer.write(value);
+		m_is_replaced = true;
+	}
+
+	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
+}
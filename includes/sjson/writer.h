@@ -30,9 +30,16 @@
 #endif
 
 #include "sjson/error.h"
+#include "sjson/key.h"
+#include "sjson/string_view.h"
 #include "sjson/version.h"
+#include "sjson/impl/base64.impl.h"
+#include "sjson/impl/hex_float.impl.h"
+#include "sjson/impl/string_escape.impl.h"
 
+#include <algorithm>
 #include <cstdio>
+#include <cstdlib>
 #include <cstdint>
 #include <cinttypes>
 #include <cmath>
@@ -51,10 +58,32 @@ namespace sjson
 	class ArrayWriter;
 	class ObjectWriter;
 
+	namespace sjson_impl
+	{
+		struct SchemaWriter;
+		class ValueTokenWriter;
+	}
+
 	// TODO: Make this an argument to the writer. For now we assume that SJSON generated files
 	// can be shared between various OS and having the most conservative line ending is safer.
 	constexpr const char* k_line_terminator = "\r\n";
 
+	// Controls how floating point values are written.
+	enum class FloatFormat : uint8_t
+	{
+		// Decimal form with 17 significant digits which always round-trips, e.g.: 12.5 or 0.10000000000000001
+		Decimal,
+
+		// Lossless C99 hexadecimal form, e.g.: 0x1.9p+3
+		// Writing and reading only requires bit manipulation which makes it much faster than decimal.
+		// It is intended for intermediate data that does not need to be human readable.
+		Hexadecimal,
+
+		// Shortest decimal form that round-trips, e.g.: 0.1
+		// Finding it formats and reads the value back up to three times, it is much slower than Decimal.
+		ShortestDecimal,
+	};
+
 	class StreamWriter
 	{
 	public:
@@ -65,6 +94,156 @@ namespace sjson
 		inline void write(const char* str) { write(str, std::strlen(str)); }
 	};
 
+	namespace sjson_impl
+	{
+		// Writes a string between quotation marks. Quotation marks, backslashes, and control
+		// characters are escaped, everything in between is copied in bulk.
+		inline void write_quoted_string(StreamWriter& stream_writer, const char* str, size_t length)
+		{
+			stream_writer.write("\"", 1);
+
+			while (true)
+			{
+				const size_t clean_length = find_first_character_to_escape(str, length);
+				if (clean_length != 0)
+					stream_writer.write(str, clean_length);
+
+				if (clean_length == length)
+					break;
+
+				char escape_sequence[8];
+				const size_t escape_sequence_length = get_escape_sequence(str[clean_length], escape_sequence);
+				stream_writer.write(escape_sequence, escape_sequence_length);
+
+				str += clean_length + 1;
+				length -= clean_length + 1;
+			}
+
+			stream_writer.write("\"", 1);
+		}
+
+		// Writes a floating point value token, NaN and infinities are written as quoted strings
+		inline void write_double(StreamWriter& stream_writer, double value, FloatFormat float_format)
+		{
+			if (std::isnan(value))
+			{
+				stream_writer.write("\"nan\"");
+			}
+			else if (std::isinf(value))
+			{
+				stream_writer.write(value < 0.0 ? "\"-inf\"" : "\"inf\"");
+			}
+			else if (float_format == FloatFormat::Hexadecimal)
+			{
+				char buffer[k_max_hex_double_length];
+				const size_t length = format_hex_double(value, buffer);
+				stream_writer.write(buffer, length);
+			}
+			else if (float_format == FloatFormat::Decimal)
+			{
+				char buffer[256];
+				const int length = snprintf(buffer, sizeof(buffer), "%.17g", value);
+				SJSON_CPP_ASSERT(length > 0 && length < static_cast<int>(sizeof(buffer)), "Failed to write SJSON value: %.17g", value);
+				stream_writer.write(buffer, static_cast<size_t>(length));
+			}
+			else
+			{
+				// Any normal value with at most 15 significant digits is printed exactly with 15 digits, only values
+				// that need more are tried with 16 and then 17 digits which always round-trips.
+				// Denormals have fewer significant bits and can need fewer digits, every precision is tried.
+				const int min_precision = std::fabs(value) < std::numeric_limits<double>::min() ? 1 : 15;
+
+				char buffer[256];
+				int length = 0;
+				for (int precision = min_precision; precision <= 17; ++precision)
+				{
+					length = snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+					SJSON_CPP_ASSERT(length > 0 && length < static_cast<int>(sizeof(buffer)), "Failed to write SJSON value: %.17g", value);
+
+					if (precision == 17 || std::strtod(buffer, nullptr) == value)
+						break;
+				}
+
+				stream_writer.write(buffer, static_cast<size_t>(length));
+			}
+		}
+
+		template<typename T>
+		struct is_c_string_pointer : std::integral_constant<bool, std::is_same<T, const char*>::value || std::is_same<T, char*>::value> {};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// A KeyView is the name of a key to write along with its length.
+	// It is implicitly constructed from:
+	//    - string literals: the length is known at compile time and no strlen is needed
+	//    - Key: the same constant can be used to read and write a member
+	//    - StringView: the length is carried with the string
+	//    - C strings and mutable char buffers: the length is computed with strlen
+	//
+	// Arrays of const char stop at the first NULL terminator, like a Key.
+	// Declaring keys as 'static constexpr KeyView k_some_key("some_key");' guarantees
+	// that everything is computed at compile time.
+	//////////////////////////////////////////////////////////////////////////
+	class KeyView
+	{
+	public:
+		template<size_t N>
+		constexpr KeyView(const char (&str)[N])
+			: m_c_str(str)
+			, m_length(sjson_impl::key_length(str, N - 1))
+			, m_requires_quotes(sjson_impl::is_constexpr_key_requiring_quotes(str, sjson_impl::key_length(str, N - 1)))
+		{}
+
+		constexpr KeyView(const Key& key)
+			: m_c_str(key.c_str())
+			, m_length(key.size())
+			, m_requires_quotes(sjson_impl::is_constexpr_key_requiring_quotes(key.c_str(), key.size()))
+		{}
+
+		template<size_t N>
+		KeyView(char (&str)[N])
+			: KeyView(str, std::strlen(str))
+		{}
+
+		template<typename T, typename std::enable_if<sjson_impl::is_c_string_pointer<T>::value>::type* = nullptr>
+		KeyView(const T& str)
+			: KeyView(str, std::strlen(str))
+		{}
+
+		KeyView(const StringView& str)
+			: KeyView(str.c_str(), str.size())
+		{}
+
+		KeyView(const char* str, size_t length)
+			: m_c_str(str)
+			, m_length(length)
+			, m_requires_quotes(sjson_impl::is_key_requiring_quotes(str, length))
+		{}
+
+		constexpr const char* c_str() const { return m_c_str; }
+		constexpr size_t size() const { return m_length; }
+
+		// Whether or not the key must be quoted and escaped to be read back
+		constexpr bool requires_quotes() const { return m_requires_quotes; }
+
+	private:
+		const char* m_c_str;
+		size_t m_length;
+		bool m_requires_quotes;
+	};
+
+	namespace sjson_impl
+	{
+		// Keys are written as-is unless they could not be read back unquoted
+		inline void write_key(StreamWriter& stream_writer, const KeyView& key)
+		{
+			if (key.requires_quotes())
+				write_quoted_string(stream_writer, key.c_str(), key.size());
+			else
+				stream_writer.write(key.c_str(), key.size());
+		}
+	}
+
 	class FileStreamWriter final : public StreamWriter
 	{
 	public:
@@ -81,6 +260,64 @@ namespace sjson
 		std::FILE* m_file = nullptr;
 	};
 
+	// A CountingStreamWriter discards everything written to it and only counts how many bytes were written.
+	// Used with a Writer, it performs a dry run of the serialization to find the exact size of the output.
+	class CountingStreamWriter final : public StreamWriter
+	{
+	public:
+		CountingStreamWriter() = default;
+
+		virtual void write(const void* buffer, size_t buffer_size) override
+		{
+			(void)buffer;
+			m_size += buffer_size;
+		}
+
+		size_t get_size() const { return m_size; }
+		void reset() { m_size = 0; }
+
+	private:
+		CountingStreamWriter(const CountingStreamWriter&) = delete;
+		CountingStreamWriter& operator=(const CountingStreamWriter&) = delete;
+
+		size_t m_size = 0;
+	};
+
+	// A BufferStreamWriter writes into a caller provided buffer of a fixed size, typically
+	// sized with a dry run through a CountingStreamWriter.
+	// Writing past the end of the buffer is an error. When asserts are disabled, the extra bytes
+	// are discarded, the buffer is marked as truncated, and get_size() keeps counting
+	// the bytes that would have been required.
+	class BufferStreamWriter final : public StreamWriter
+	{
+	public:
+		BufferStreamWriter(void* buffer, size_t buffer_size)
+			: m_buffer(static_cast<char*>(buffer))
+			, m_buffer_size(buffer_size)
+		{}
+
+		virtual void write(const void* buffer, size_t buffer_size) override
+		{
+			SJSON_CPP_ASSERT(buffer_size <= m_buffer_size - std::min(m_size, m_buffer_size), "BufferStreamWriter is too small for the output");
+
+			if (m_size < m_buffer_size)
+				std::memcpy(m_buffer + m_size, buffer, std::min(buffer_size, m_buffer_size - m_size));
+
+			m_size += buffer_size;
+		}
+
+		size_t get_size() const { return m_size; }
+		bool is_truncated() const { return m_size > m_buffer_size; }
+
+	private:
+		BufferStreamWriter(const BufferStreamWriter&) = delete;
+		BufferStreamWriter& operator=(const BufferStreamWriter&) = delete;
+
+		char* m_buffer;
+		size_t m_buffer_size;
+		size_t m_size = 0;
+	};
+
 	// A lambda that does not capture anything is equivalent to a static function
 	// and calling a function with it as an argument is equivalent to passing a function pointer.
 	// Of course, a pointer can safely and automatically coerce to 'bool' and as such
@@ -95,7 +332,11 @@ namespace sjson
 	class ArrayWriter
 	{
 	public:
-		void push(const char* value);
+		template<typename T, typename std::enable_if<sjson_impl::is_c_string_pointer<T>::value>::type* = nullptr>
+		void push(const T& value) { push(StringView(value)); }
+		template<size_t N> void push(const char (&value)[N]) { push(StringView(value, N - 1)); }
+		template<size_t N> void push(char (&value)[N]) { push(StringView(value)); }
+		void push(const StringView& value);
 		void push(bool value);
 		void push(double value);
 		void push(float value) { push(double(value)); }
@@ -114,12 +355,24 @@ namespace sjson
 		template<typename F, typename HavingArgument<F, ArrayWriter&>::type* requirement = nullptr>
 		void push(F writer_fun);
 
+		void push_null();
+
+		// Splices an object written separately with an ObjectFragmentWriter.
+		// The fragment must have been written with the indentation level returned by get_fragment_indent_level().
+		void push_fragment(const void* fragment, size_t fragment_size);
+
 		// TODO: Introduce a newline type
 		void push_newline();
 
-	private:
-		ArrayWriter(StreamWriter& stream_writer, uint32_t indent_level);
+		// The indentation level at which the members of an object pushed in this array are written.
+		uint32_t get_fragment_indent_level() const { return m_indent_level + 1; }
+
+		FloatFormat get_float_format() const { return m_float_format; }
+
+	protected:
+		ArrayWriter(StreamWriter& stream_writer, uint32_t indent_level, FloatFormat float_format);
 
+	private:
 		ArrayWriter(const ArrayWriter&) = delete;
 		ArrayWriter& operator=(const ArrayWriter&) = delete;
 
@@ -129,6 +382,7 @@ namespace sjson
 
 		StreamWriter& m_stream_writer;
 		uint32_t m_indent_level = 0;
+		FloatFormat m_float_format = FloatFormat::Decimal;
 		bool m_is_empty = true;
 		bool m_is_newline = false;
 
@@ -137,32 +391,57 @@ namespace sjson
 #endif
 
 		friend ObjectWriter;
+		friend sjson_impl::ValueTokenWriter;
 	};
 
 	class ObjectWriter
 	{
 	public:
-		void insert(const char* key, const char* value);
-		void insert(const char* key, bool value);
-		void insert(const char* key, double value);
-		void insert(const char* key, float value) { insert(key, double(value)); }
-		void insert(const char* key, int8_t value) { insert_signed_integer(key, int64_t(value)); }
-		void insert(const char* key, uint8_t value) { insert_unsigned_integer(key, uint64_t(value)); }
-		void insert(const char* key, int16_t value) { insert_signed_integer(key, int64_t(value)); }
-		void insert(const char* key, uint16_t value) { insert_unsigned_integer(key, uint64_t(value)); }
-		void insert(const char* key, int32_t value) { insert_signed_integer(key, int64_t(value)); }
-		void insert(const char* key, uint32_t value) { insert_unsigned_integer(key, uint64_t(value)); }
-		void insert(const char* key, int64_t value) { insert_signed_integer(key, int64_t(value)); }
-		void insert(const char* key, uint64_t value) { insert_unsigned_integer(key, uint64_t(value)); }
+		template<typename T, typename std::enable_if<sjson_impl::is_c_string_pointer<T>::value>::type* = nullptr>
+		void insert(const KeyView& key, const T& value) { insert(key, StringView(value)); }
+		template<size_t N> void insert(const KeyView& key, const char (&value)[N]) { insert(key, StringView(value, N - 1)); }
+		template<size_t N> void insert(const KeyView& key, char (&value)[N]) { insert(key, StringView(value)); }
+		void insert(const KeyView& key, const StringView& value);
+		void insert(const KeyView& key, bool value);
+		void insert(const KeyView& key, double value);
+		void insert(const KeyView& key, float value) { insert(key, double(value)); }
+		void insert(const KeyView& key, int8_t value) { insert_signed_integer(key, int64_t(value)); }
+		void insert(const KeyView& key, uint8_t value) { insert_unsigned_integer(key, uint64_t(value)); }
+		void insert(const KeyView& key, int16_t value) { insert_signed_integer(key, int64_t(value)); }
+		void insert(const KeyView& key, uint16_t value) { insert_unsigned_integer(key, uint64_t(value)); }
+		void insert(const KeyView& key, int32_t value) { insert_signed_integer(key, int64_t(value)); }
+		void insert(const KeyView& key, uint32_t value) { insert_unsigned_integer(key, uint64_t(value)); }
+		void insert(const KeyView& key, int64_t value) { insert_signed_integer(key, int64_t(value)); }
+		void insert(const KeyView& key, uint64_t value) { insert_unsigned_integer(key, uint64_t(value)); }
 
 		template<typename F, typename HavingArgument<F, ObjectWriter&>::type* requirement = nullptr>
-		void insert(const char* key, F writer_fun);
+		void insert(const KeyView& key, F writer_fun);
 
 		template<typename F, typename HavingArgument<F, ArrayWriter&>::type* requirement = nullptr>
-		void insert(const char* key, F writer_fun);
+		void insert(const KeyView& key, F writer_fun);
+
+		// Writes a null literal, e.g.: key = null
+		void insert_null(const KeyView& key);
+
+		// Writes binary data as a base64 string, e.g.: key = "AAAgQQAAoEA="
+		// Typed variants write the raw bytes of the values in native endianness,
+		// the number of elements is provided instead of the size in bytes.
+		void insert_blob(const KeyView& key, const void* data, size_t data_size);
+
+		template<typename T, typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr>
+		void insert_blob(const KeyView& key, const T* values, size_t num_elements) { insert_blob(key, static_cast<const void*>(values), num_elements * sizeof(T)); }
+
+		// Splices an object written separately with an ObjectFragmentWriter.
+		// The fragment must have been written with the indentation level returned by get_fragment_indent_level().
+		void insert_fragment(const KeyView& key, const void* fragment, size_t fragment_size);
 
 		void insert_newline();
 
+		// The indentation level at which the members of an object inserted in this object are written.
+		uint32_t get_fragment_indent_level() const { return m_indent_level + 1; }
+
+		FloatFormat get_float_format() const { return m_float_format; }
+
 		// Implement operator[] for convenience
 		class ValueRef final
 		{
@@ -170,7 +449,11 @@ namespace sjson
 			ValueRef(ValueRef&& other) noexcept;
 			~ValueRef();
 
-			void operator=(const char* value);
+			template<typename T, typename std::enable_if<sjson_impl::is_c_string_pointer<T>::value>::type* = nullptr>
+			void operator=(const T& value) { *this = StringView(value); }
+			template<size_t N> void operator=(const char (&value)[N]) { *this = StringView(value, N - 1); }
+			template<size_t N> void operator=(char (&value)[N]) { *this = StringView(value); }
+			void operator=(const StringView& value);
 			void operator=(bool value);
 			void operator=(double value);
 			void operator=(float value) { *this = double(value); }
@@ -190,7 +473,7 @@ namespace sjson
 			void operator=(F writer_fun);
 
 		private:
-			ValueRef(ObjectWriter& object_writer, const char* key);
+			ValueRef(ObjectWriter& object_writer, const KeyView& key);
 
 			ValueRef(const ValueRef&) = delete;
 			ValueRef& operator=(const ValueRef&) = delete;
@@ -208,21 +491,22 @@ namespace sjson
 			friend ObjectWriter;
 		};
 
-		ValueRef operator[](const char* key) { return ValueRef(*this, key); }
+		ValueRef operator[](const KeyView& key) { return ValueRef(*this, key); }
 
 	protected:
-		inline ObjectWriter(StreamWriter& stream_writer, uint32_t indent_level);
+		inline ObjectWriter(StreamWriter& stream_writer, uint32_t indent_level, FloatFormat float_format);
 
 		ObjectWriter(const ObjectWriter&) = delete;
 		ObjectWriter& operator=(const ObjectWriter&) = delete;
 
-		void insert_signed_integer(const char* key, int64_t value);
-		void insert_unsigned_integer(const char* key, uint64_t value);
+		void insert_signed_integer(const KeyView& key, int64_t value);
+		void insert_unsigned_integer(const KeyView& key, uint64_t value);
 		void write_indentation();
 
 	private:
 		StreamWriter& m_stream_writer;
 		uint32_t m_indent_level = 0;
+		FloatFormat m_float_format = FloatFormat::Decimal;
 		bool m_has_live_value_ref = false;
 
 #if defined(SJSON_CPP_HAS_ASSERT_CHECKS)
@@ -230,130 +514,202 @@ namespace sjson
 #endif
 
 		friend ArrayWriter;
+		friend sjson_impl::SchemaWriter;
 	};
 
 	class Writer : public ObjectWriter
 	{
 	public:
-		explicit Writer(StreamWriter& stream_writer);
+		explicit Writer(StreamWriter& stream_writer, FloatFormat float_format = FloatFormat::Decimal);
 
 	private:
 		Writer(const Writer&) = delete;
 		Writer& operator=(const Writer&) = delete;
 	};
 
+	// An ObjectFragmentWriter writes the members of an object into its own stream, without the
+	// enclosing braces, so that it can later be spliced into its parent with
+	// ObjectWriter::insert_fragment or ArrayWriter::push_fragment. The spliced output is
+	// identical to what writing the object in place would have produced.
+	//
+	// Fragments do not share any state with their parent or with each other and as such
+	// independent fragments can be written concurrently from multiple threads, as long as
+	// each fragment uses its own StreamWriter. Splicing must then happen in order on the
+	// thread that owns the parent writer.
+	//
+	// e.g.:
+	//    // On a worker thread, for each track
+	//    ObjectFragmentWriter fragment_writer(track_stream_writer, array_writer.get_fragment_indent_level());
+	//    write_track(fragment_writer, track);
+	//
+	//    // Once all workers are done, in order
+	//    array_writer.push_fragment(track_buffer, track_buffer_size);
+	class ObjectFragmentWriter final : public ObjectWriter
+	{
+	public:
+		// Fragments must use the same float format as the writer they are spliced into
+		ObjectFragmentWriter(StreamWriter& stream_writer, uint32_t indent_level, FloatFormat float_format = FloatFormat::Decimal);
+
+	private:
+		ObjectFragmentWriter(const ObjectFragmentWriter&) = delete;
+		ObjectFragmentWriter& operator=(const ObjectFragmentWriter&) = delete;
+	};
+
+	namespace sjson_impl
+	{
+		// Writes a single value where a value starts within existing SJSON text, used to replace or add values in place.
+		// The value can be anything that ArrayWriter::push accepts. Objects and arrays open on the current line and
+		// their members and elements are indented one level past the provided one, the level of the line they start on.
+		class ValueTokenWriter final : public ArrayWriter
+		{
+		public:
+			ValueTokenWriter(StreamWriter& stream_writer, uint32_t indent_level, FloatFormat float_format)
+				: ArrayWriter(stream_writer, indent_level, float_format)
+			{}
+
+			template<typename T>
+			void write(const T& value)
+			{
+				write(value, std::is_constructible<std::function<void(ObjectWriter&)>, T>(), std::is_constructible<std::function<void(ArrayWriter&)>, T>());
+			}
+
+		private:
+			template<typename T>
+			void write(const T& value, std::false_type, std::false_type) { push(value); }
+
+			template<typename F>
+			void write(const F& writer_fun, std::true_type, std::false_type)
+			{
+				m_stream_writer.write("{");
+				m_stream_writer.write(k_line_terminator);
+
+				ObjectFragmentWriter object_writer(m_stream_writer, m_indent_level + 1, m_float_format);
+				writer_fun(object_writer);
+
+				write_indentation();
+				m_stream_writer.write("}");
+			}
+
+			template<typename F>
+			void write(const F& writer_fun, std::false_type, std::true_type)
+			{
+				m_stream_writer.write("[ ");
+
+				ValueTokenWriter array_writer(m_stream_writer, m_indent_level + 1, m_float_format);
+				writer_fun(array_writer);
+
+				if (array_writer.m_is_newline)
+				{
+					write_indentation();
+					m_stream_writer.write("]");
+				}
+				else
+					m_stream_writer.write(" ]");
+			}
+		};
+	}
+
+	// Runs the provided writer function in a dry run and returns the exact number of bytes it writes.
+	// The float format must be the one of the writer that will write the output.
+	// e.g.:
+	//    const size_t size = get_serialized_size([&](Writer& writer) { write_clip(writer, clip); });
+	//    BufferStreamWriter buffer_writer(allocate(size), size);
+	//    Writer writer(buffer_writer);
+	//    write_clip(writer, clip);
+	template<typename F, typename HavingArgument<F, Writer&>::type* requirement = nullptr>
+	size_t get_serialized_size(F writer_fun, FloatFormat float_format = FloatFormat::Decimal);
+
 	//////////////////////////////////////////////////////////////////////////
 
-	inline ObjectWriter::ObjectWriter(StreamWriter& stream_writer, uint32_t indent_level)
+	inline ObjectWriter::ObjectWriter(StreamWriter& stream_writer, uint32_t indent_level, FloatFormat float_format)
 		: m_stream_writer(stream_writer)
 		, m_indent_level(indent_level)
+		, m_float_format(float_format)
 	{}
 
-	inline void ObjectWriter::insert(const char* key, const char* value)
+	inline void ObjectWriter::insert(const KeyView& key, const StringView& value)
 	{
 		SJSON_CPP_ASSERT(!m_is_locked, "Cannot insert SJSON value in locked object");
 		SJSON_CPP_ASSERT(!m_has_live_value_ref, "Cannot insert SJSON value in object when it has a live ValueRef");
 
 		write_indentation();
 
-		m_stream_writer.write(key);
-		m_stream_writer.write(" = \"");
-		m_stream_writer.write(value);
-		m_stream_writer.write("\"");
+		sjson_impl::write_key(m_stream_writer, key);
+		m_stream_writer.write(" = ");
+		sjson_impl::write_quoted_string(m_stream_writer, value.c_str(), value.size());
 		m_stream_writer.write(k_line_terminator);
 	}
 
-	inline void ObjectWriter::insert(const char* key, bool value)
+	inline void ObjectWriter::insert(const KeyView& key, bool value)
 	{
 		SJSON_CPP_ASSERT(!m_is_locked, "Cannot insert SJSON value in locked object");
 		SJSON_CPP_ASSERT(!m_has_live_value_ref, "Cannot insert SJSON value in object when it has a live ValueRef");
 
 		write_indentation();
 
-		m_stream_writer.write(key);
+		sjson_impl::write_key(m_stream_writer, key);
 		m_stream_writer.write(" = ");
 
 		char buffer[256];
 		int length = snprintf(buffer, sizeof(buffer), "%s%s", value ? "true" : "false", k_line_terminator);
-		SJSON_CPP_ASSERT(length > 0 && length < static_cast<int>(sizeof(buffer)), "Failed to insert SJSON value: [" SJSON_ASSERT_STRING_FORMAT_SPECIFIER " = " SJSON_ASSERT_STRING_FORMAT_SPECIFIER "]", key, value);
+		SJSON_CPP_ASSERT(length > 0 && length < static_cast<int>(sizeof(buffer)), "Failed to insert SJSON value: [" SJSON_ASSERT_STRING_FORMAT_SPECIFIER " = " SJSON_ASSERT_STRING_FORMAT_SPECIFIER "]", key.c_str(), value);
 		m_stream_writer.write(buffer, static_cast<size_t>(length));
 	}
 
-	inline void ObjectWriter::insert(const char* key, double value)
+	inline void ObjectWriter::insert(const KeyView& key, double value)
 	{
 		SJSON_CPP_ASSERT(!m_is_locked, "Cannot insert SJSON value in locked object");
 		SJSON_CPP_ASSERT(!m_has_live_value_ref, "Cannot insert SJSON value in object when it has a live ValueRef");
 
 		write_indentation();
 
-		m_stream_writer.write(key);
+		sjson_impl::write_key(m_stream_writer, key);
 		m_stream_writer.write(" = ");
-
-		if (std::isnan(value))
-		{
-			m_stream_writer.write("\"nan\"");
-			m_stream_writer.write(k_line_terminator);
-		}
-		else if (std::isinf(value))
-		{
-			m_stream_writer.write("\"");
-
-			if (value < 0.0)
-				m_stream_writer.write("-");
-
-			m_stream_writer.write("inf\"");
-			m_stream_writer.write(k_line_terminator);
-		}
-		else
-		{
-			char buffer[256];
-			int length = snprintf(buffer, sizeof(buffer), "%.17g%s", value, k_line_terminator);
-			SJSON_CPP_ASSERT(length > 0 && length < static_cast<int>(sizeof(buffer)), "Failed to insert SJSON value: [" SJSON_ASSERT_STRING_FORMAT_SPECIFIER " = %.17g]", key, value);
-			m_stream_writer.write(buffer, static_cast<size_t>(length));
-		}
+		sjson_impl::write_double(m_stream_writer, value, m_float_format);
+		m_stream_writer.write(k_line_terminator);
 	}
 
-	inline void ObjectWriter::insert_signed_integer(const char* key, int64_t value)
+	inline void ObjectWriter::insert_signed_integer(const KeyView& key, int64_t value)
 	{
 		SJSON_CPP_ASSERT(!m_is_locked, "Cannot insert SJSON value in locked object");
 		SJSON_CPP_ASSERT(!m_has_live_value_ref, "Cannot insert SJSON value in object when it has a live ValueRef");
 
 		write_indentation();
 
-		m_stream_writer.write(key);
+		sjson_impl::write_key(m_stream_writer, key);
 		m_stream_writer.write(" = ");
 
 		char buffer[256];
 		int length = snprintf(buffer, sizeof(buffer), "%" PRId64 "%s", value, k_line_terminator);
-		SJSON_CPP_ASSERT(length > 0 && length < static_cast<int>(sizeof(buffer)), "Failed to insert SJSON value: [" SJSON_ASSERT_STRING_FORMAT_SPECIFIER " = %lld]", key, value);
+		SJSON_CPP_ASSERT(length > 0 && length < static_cast<int>(sizeof(buffer)), "Failed to insert SJSON value: [" SJSON_ASSERT_STRING_FORMAT_SPECIFIER " = %lld]", key.c_str(), value);
 		m_stream_writer.write(buffer, static_cast<size_t>(length));
 	}
 
-	inline void ObjectWriter::insert_unsigned_integer(const char* key, uint64_t value)
+	inline void ObjectWriter::insert_unsigned_integer(const KeyView& key, uint64_t value)
 	{
 		SJSON_CPP_ASSERT(!m_is_locked, "Cannot insert SJSON value in locked object");
 		SJSON_CPP_ASSERT(!m_has_live_value_ref, "Cannot insert SJSON value in object when it has a live ValueRef");
 
 		write_indentation();
 
-		m_stream_writer.write(key);
+		sjson_impl::write_key(m_stream_writer, key);
 		m_stream_writer.write(" = ");
 
 		char buffer[256];
 		int length = snprintf(buffer, sizeof(buffer), "%" PRIu64 "%s", value, k_line_terminator);
-		SJSON_CPP_ASSERT(length > 0 && length < static_cast<int>(sizeof(buffer)), "Failed to insert SJSON value: [" SJSON_ASSERT_STRING_FORMAT_SPECIFIER " = %llu]", key, value);
+		SJSON_CPP_ASSERT(length > 0 && length < static_cast<int>(sizeof(buffer)), "Failed to insert SJSON value: [" SJSON_ASSERT_STRING_FORMAT_SPECIFIER " = %llu]", key.c_str(), value);
 		m_stream_writer.write(buffer, static_cast<size_t>(length));
 	}
 
 	template<typename F, typename HavingArgument<F, ObjectWriter&>::type* requirement>
-	inline void ObjectWriter::insert(const char* key, F writer_fun)
+	inline void ObjectWriter::insert(const KeyView& key, F writer_fun)
 	{
 		SJSON_CPP_ASSERT(!m_is_locked, "Cannot insert SJSON object in locked object");
 		SJSON_CPP_ASSERT(!m_has_live_value_ref, "Cannot insert SJSON object in object when it has a live ValueRef");
 
 		write_indentation();
 
-		m_stream_writer.write(key);
+		sjson_impl::write_key(m_stream_writer, key);
 		m_stream_writer.write(" = {");
 		m_stream_writer.write(k_line_terminator);
 
@@ -361,7 +717,7 @@ namespace sjson
 		m_is_locked = true;
 #endif
 
-		ObjectWriter object_writer(m_stream_writer, m_indent_level + 1);
+		ObjectWriter object_writer(m_stream_writer, m_indent_level + 1, m_float_format);
 		writer_fun(object_writer);
 
 #if defined(SJSON_CPP_HAS_ASSERT_CHECKS)
@@ -375,21 +731,21 @@ namespace sjson
 	}
 
 	template<typename F, typename HavingArgument<F, ArrayWriter&>::type* requirement >
-	inline void ObjectWriter::insert(const char* key, F writer_fun)
+	inline void ObjectWriter::insert(const KeyView& key, F writer_fun)
 	{
 		SJSON_CPP_ASSERT(!m_is_locked, "Cannot insert SJSON array in locked object");
 		SJSON_CPP_ASSERT(!m_has_live_value_ref, "Cannot insert SJSON array in object when it has a live ValueRef");
 
 		write_indentation();
 
-		m_stream_writer.write(key);
+		sjson_impl::write_key(m_stream_writer, key);
 		m_stream_writer.write(" = [ ");
 
 #if defined(SJSON_CPP_HAS_ASSERT_CHECKS)
 		m_is_locked = true;
 #endif
 
-		ArrayWriter array_writer(m_stream_writer, m_indent_level + 1);
+		ArrayWriter array_writer(m_stream_writer, m_indent_level + 1, m_float_format);
 		writer_fun(array_writer);
 
 		if (array_writer.m_is_newline)
@@ -409,6 +765,63 @@ namespace sjson
 #endif
 	}
 
+	inline void ObjectWriter::insert_null(const KeyView& key)
+	{
+		SJSON_CPP_ASSERT(!m_is_locked, "Cannot insert SJSON value in locked object");
+		SJSON_CPP_ASSERT(!m_has_live_value_ref, "Cannot insert SJSON value in object when it has a live ValueRef");
+
+		write_indentation();
+
+		sjson_impl::write_key(m_stream_writer, key);
+		m_stream_writer.write(" = null");
+		m_stream_writer.write(k_line_terminator);
+	}
+
+	inline void ObjectWriter::insert_blob(const KeyView& key, const void* data, size_t data_size)
+	{
+		SJSON_CPP_ASSERT(!m_is_locked, "Cannot insert SJSON value in locked object");
+		SJSON_CPP_ASSERT(!m_has_live_value_ref, "Cannot insert SJSON value in object when it has a live ValueRef");
+
+		write_indentation();
+
+		sjson_impl::write_key(m_stream_writer, key);
+		m_stream_writer.write(" = \"");
+
+		// Encode in chunks, every chunk but the last must be a multiple of 3 bytes to avoid padding
+		constexpr size_t k_chunk_size = 3 * 256;
+		char buffer[sjson_impl::get_base64_encoded_size(k_chunk_size)];
+
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		for (size_t offset = 0; offset < data_size; offset += k_chunk_size)
+		{
+			const size_t chunk_size = std::min(k_chunk_size, data_size - offset);
+			const size_t length = sjson_impl::encode_base64(bytes + offset, chunk_size, buffer);
+			m_stream_writer.write(buffer, length);
+		}
+
+		m_stream_writer.write("\"");
+		m_stream_writer.write(k_line_terminator);
+	}
+
+	inline void ObjectWriter::insert_fragment(const KeyView& key, const void* fragment, size_t fragment_size)
+	{
+		SJSON_CPP_ASSERT(!m_is_locked, "Cannot insert SJSON object in locked object");
+		SJSON_CPP_ASSERT(!m_has_live_value_ref, "Cannot insert SJSON object in object when it has a live ValueRef");
+
+		write_indentation();
+
+		sjson_impl::write_key(m_stream_writer, key);
+		m_stream_writer.write(" = {");
+		m_stream_writer.write(k_line_terminator);
+
+		m_stream_writer.write(fragment, fragment_size);
+
+		write_indentation();
+
+		m_stream_writer.write("}");
+		m_stream_writer.write(k_line_terminator);
+	}
+
 	inline void ObjectWriter::write_indentation()
 	{
 		for (uint32_t level = 0; level < m_indent_level; ++level)
@@ -423,14 +836,14 @@ namespace sjson
 		m_stream_writer.write(k_line_terminator);
 	}
 
-	inline ObjectWriter::ValueRef::ValueRef(ObjectWriter& object_writer, const char* key)
+	inline ObjectWriter::ValueRef::ValueRef(ObjectWriter& object_writer, const KeyView& key)
 		: m_object_writer(&object_writer)
 	{
 		SJSON_CPP_ASSERT(!object_writer.m_is_locked, "Cannot insert SJSON value in locked object");
 		SJSON_CPP_ASSERT(!object_writer.m_has_live_value_ref, "Cannot insert SJSON value in object when it has a live ValueRef");
 
 		object_writer.write_indentation();
-		object_writer.m_stream_writer.write(key);
+		sjson_impl::write_key(object_writer.m_stream_writer, key);
 		object_writer.m_stream_writer.write(" = ");
 		object_writer.m_has_live_value_ref = true;
 
@@ -466,15 +879,13 @@ namespace sjson
 		}
 	}
 
-	inline void ObjectWriter::ValueRef::operator=(const char* value)
+	inline void ObjectWriter::ValueRef::operator=(const StringView& value)
 	{
 		SJSON_CPP_ASSERT(m_is_empty, "Cannot write multiple values within a ValueRef");
 		SJSON_CPP_ASSERT(m_object_writer != nullptr, "ValueRef not initialized");
 		SJSON_CPP_ASSERT(!m_is_locked, "Cannot assign a value when locked");
 
-		m_object_writer->m_stream_writer.write("\"");
-		m_object_writer->m_stream_writer.write(value);
-		m_object_writer->m_stream_writer.write("\"");
+		sjson_impl::write_quoted_string(m_object_writer->m_stream_writer, value.c_str(), value.size());
 		m_object_writer->m_stream_writer.write(k_line_terminator);
 		m_is_empty = false;
 	}
@@ -498,29 +909,8 @@ namespace sjson
 		SJSON_CPP_ASSERT(m_object_writer != nullptr, "ValueRef not initialized");
 		SJSON_CPP_ASSERT(!m_is_locked, "Cannot assign a value when locked");
 
-		if (std::isnan(value))
-		{
-			m_object_writer->m_stream_writer.write("\"nan\"");
-			m_object_writer->m_stream_writer.write(k_line_terminator);
-		}
-		else if (std::isinf(value))
-		{
-			m_object_writer->m_stream_writer.write("\"");
-
-			if (value < 0.0)
-				m_object_writer->m_stream_writer.write("-");
-
-			m_object_writer->m_stream_writer.write("inf\"");
-			m_object_writer->m_stream_writer.write(k_line_terminator);
-		}
-		else
-		{
-			char buffer[256];
-			int length = snprintf(buffer, sizeof(buffer), "%.17g%s", value, k_line_terminator);
-			SJSON_CPP_ASSERT(length > 0 && length < static_cast<int>(sizeof(buffer)), "Failed to assign SJSON value: %.17g", value);
-			m_object_writer->m_stream_writer.write(buffer, static_cast<size_t>(length));
-		}
-
+		sjson_impl::write_double(m_object_writer->m_stream_writer, value, m_object_writer->m_float_format);
+		m_object_writer->m_stream_writer.write(k_line_terminator);
 		m_is_empty = false;
 	}
 
@@ -538,7 +928,7 @@ namespace sjson
 		m_is_locked = true;
 #endif
 
-		ObjectWriter object_writer(m_object_writer->m_stream_writer, m_object_writer->m_indent_level + 1);
+		ObjectWriter object_writer(m_object_writer->m_stream_writer, m_object_writer->m_indent_level + 1, m_object_writer->m_float_format);
 		writer_fun(object_writer);
 
 #if defined(SJSON_CPP_HAS_ASSERT_CHECKS)
@@ -564,7 +954,7 @@ namespace sjson
 		m_is_locked = true;
 #endif
 
-		ArrayWriter array_writer(m_object_writer->m_stream_writer, m_object_writer->m_indent_level + 1);
+		ArrayWriter array_writer(m_object_writer->m_stream_writer, m_object_writer->m_indent_level + 1, m_object_writer->m_float_format);
 		writer_fun(array_writer);
 
 		if (array_writer.m_is_newline)
@@ -614,12 +1004,13 @@ namespace sjson
 
 	//////////////////////////////////////////////////////////////////////////
 
-	inline ArrayWriter::ArrayWriter(StreamWriter& stream_writer, uint32_t indent_level)
+	inline ArrayWriter::ArrayWriter(StreamWriter& stream_writer, uint32_t indent_level, FloatFormat float_format)
 		: m_stream_writer(stream_writer)
 		, m_indent_level(indent_level)
+		, m_float_format(float_format)
 	{}
 
-	inline void ArrayWriter::push(const char* value)
+	inline void ArrayWriter::push(const StringView& value)
 	{
 		SJSON_CPP_ASSERT(!m_is_locked, "Cannot push SJSON value in locked array");
 
@@ -629,9 +1020,7 @@ namespace sjson
 		if (m_is_newline)
 			write_indentation();
 
-		m_stream_writer.write("\"");
-		m_stream_writer.write(value);
-		m_stream_writer.write("\"");
+		sjson_impl::write_quoted_string(m_stream_writer, value.c_str(), value.size());
 		m_is_empty = false;
 		m_is_newline = false;
 	}
@@ -664,27 +1053,7 @@ namespace sjson
 		if (m_is_newline)
 			write_indentation();
 
-		if (std::isnan(value))
-		{
-			m_stream_writer.write("\"nan\"");
-		}
-		else if (std::isinf(value))
-		{
-			m_stream_writer.write("\"");
-
-			if (value < 0.0)
-				m_stream_writer.write("-");
-
-			m_stream_writer.write("inf\"");
-		}
-		else
-		{
-			char buffer[256];
-			int length = snprintf(buffer, sizeof(buffer), "%.17g", value);
-			SJSON_CPP_ASSERT(length > 0 && length < static_cast<int>(sizeof(buffer)), "Failed to push SJSON value: %.17g", value);
-			m_stream_writer.write(buffer, static_cast<size_t>(length));
-		}
-
+		sjson_impl::write_double(m_stream_writer, value, m_float_format);
 		m_is_empty = false;
 		m_is_newline = false;
 	}
@@ -746,7 +1115,7 @@ namespace sjson
 		m_is_locked = true;
 #endif
 
-		ObjectWriter object_writer(m_stream_writer, m_indent_level + 1);
+		ObjectWriter object_writer(m_stream_writer, m_indent_level + 1, m_float_format);
 		writer_fun(object_writer);
 
 		write_indentation();
@@ -778,7 +1147,7 @@ namespace sjson
 		m_is_locked = true;
 #endif
 
-		ArrayWriter array_writer(m_stream_writer, m_indent_level);
+		ArrayWriter array_writer(m_stream_writer, m_indent_level, m_float_format);
 		writer_fun(array_writer);
 
 #if defined(SJSON_CPP_HAS_ASSERT_CHECKS)
@@ -790,6 +1159,47 @@ namespace sjson
 		m_is_newline = false;
 	}
 
+	inline void ArrayWriter::push_null()
+	{
+		SJSON_CPP_ASSERT(!m_is_locked, "Cannot push SJSON value in locked array");
+
+		if (!m_is_empty && !m_is_newline)
+			m_stream_writer.write(", ");
+
+		if (m_is_newline)
+			write_indentation();
+
+		m_stream_writer.write("null");
+		m_is_empty = false;
+		m_is_newline = false;
+	}
+
+	inline void ArrayWriter::push_fragment(const void* fragment, size_t fragment_size)
+	{
+		SJSON_CPP_ASSERT(!m_is_locked, "Cannot push SJSON object in locked array");
+
+		if (!m_is_empty && !m_is_newline)
+		{
+			m_stream_writer.write(",");
+			m_stream_writer.write(k_line_terminator);
+		}
+		else if (m_is_empty)
+			m_stream_writer.write(k_line_terminator);
+
+		write_indentation();
+		m_stream_writer.write("{");
+		m_stream_writer.write(k_line_terminator);
+
+		m_stream_writer.write(fragment, fragment_size);
+
+		write_indentation();
+		m_stream_writer.write("}");
+		m_stream_writer.write(k_line_terminator);
+
+		m_is_empty = false;
+		m_is_newline = true;
+	}
+
 	inline void ArrayWriter::push_newline()
 	{
 		SJSON_CPP_ASSERT(!m_is_locked, "Cannot insert newline in locked array");
@@ -806,8 +1216,23 @@ namespace sjson
 
 	//////////////////////////////////////////////////////////////////////////
 
-	inline Writer::Writer(StreamWriter& stream_writer)
-		: ObjectWriter(stream_writer, 0)
+	inline Writer::Writer(StreamWriter& stream_writer, FloatFormat float_format)
+		: ObjectWriter(stream_writer, 0, float_format)
+	{}
+
+	template<typename F, typename HavingArgument<F, Writer&>::type* requirement>
+	inline size_t get_serialized_size(F writer_fun, FloatFormat float_format)
+	{
+		CountingStreamWriter counting_writer;
+		Writer writer(counting_writer, float_format);
+		writer_fun(writer);
+		return counting_writer.get_size();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline ObjectFragmentWriter::ObjectFragmentWriter(StreamWriter& stream_writer, uint32_t indent_level, FloatFormat float_format)
+		: ObjectWriter(stream_writer, indent_level, float_format)
 	{}
 
 	SJSON_CPP_IMPL_VERSION_NAMESPACE_END
@@ -0,0 +1,360 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "catch2.impl.h"
+#include "test_helpers.h"
+
+#include <sjson/binary_compiler.h>
+#include <sjson/binary_reader.h>
+#include <sjson/parser.h>
+#include <sjson/writer.h>
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace sjson;
+
+static std::vector<uint8_t> compile_c_str(const char* c_str)
+{
+	Parser parser(c_str, std::strlen(c_str));
+	const size_t document_size = compile_binary(parser, nullptr, 0);
+	REQUIRE(document_size != 0);
+
+	std::vector<uint8_t> document(document_size);
+	Parser document_parser(c_str, std::strlen(c_str));
+	REQUIRE(compile_binary(document_parser, document.data(), document.size()) == document_size);
+	return document;
+}
+
+static std::string decompile(const std::vector<uint8_t>& document)
+{
+	BinaryReader reader(document.data(), document.size());
+	StringStreamWriter str_writer;
+	Writer writer(str_writer);
+	CHECK(decompile_binary(reader, writer));
+	CHECK(reader.is_valid());
+	return str_writer.str();
+}
+
+TEST_CASE("Binary Reading", "[binary]")
+{
+	const char* input =
+		"// Comments and whitespace are stripped\r\n"
+		"name = \"tab\\tquote\\\" \\u00e9\\ud83d\\ude00\"\r\n"
+		"\"quoted key\" = true\r\n"
+		"integer = -12\r\n"
+		"large = 18446744073709551615\r\n"
+		"hex = 0x1F\r\n"
+		"real = 2.5\r\n"
+		"exponent = 1e3\r\n";
+
+	const std::vector<uint8_t> document = compile_c_str(input);
+	BinaryReader reader(document.data(), document.size());
+
+	StringView name;
+	CHECK(reader.read("name", name));
+	CHECK(name == "tab\tquote\" \xC3\xA9\xF0\x9F\x98\x80");
+
+	bool quoted = false;
+	CHECK(reader.read("quoted key", quoted));
+	CHECK(quoted);
+
+	uint8_t out_of_range;
+	CHECK_FALSE(reader.read("integer", out_of_range));
+	CHECK(reader.get_error().error == ParserError::NumberCouldNotBeConverted);
+	reader.reset_state();
+	reader.read("name", name);
+	reader.read("quoted key", quoted);
+
+	int32_t integer = 0;
+	CHECK(reader.read("integer", integer));
+	CHECK(integer == -12);
+
+	uint64_t large = 0;
+	CHECK(reader.read("large", large));
+	CHECK(large == 18446744073709551615ULL);
+
+	uint8_t hex = 0;
+	CHECK(reader.read("hex", hex));
+	CHECK(hex == 0x1F);
+
+	float real = 0.0F;
+	CHECK(reader.read("real", real));
+	CHECK(real == 2.5F);
+
+	int32_t not_an_integer;
+	CHECK_FALSE(reader.read("exponent", not_an_integer));
+	CHECK(reader.get_error().error == ParserError::NumberExpected);
+}
+
+TEST_CASE("Binary Number Classification", "[binary]")
+{
+	const char* input =
+		"hex_with_e = 0x1E\r\n"
+		"hex_float = 0x1.8p1\r\n"
+		"negative_zero = -0\r\n"
+		"octal = 010\r\n"
+		"too_large = 99999999999999999999\r\n";
+
+	const std::vector<uint8_t> document = compile_c_str(input);
+	BinaryReader reader(document.data(), document.size());
+
+	int32_t hex_with_e = 0;
+	CHECK(reader.read("hex_with_e", hex_with_e));
+	CHECK(hex_with_e == 0x1E);
+
+	double hex_float = 0.0;
+	CHECK(reader.read("hex_float", hex_float));
+	CHECK(hex_float == 3.0);
+
+	double negative_zero = 1.0;
+	CHECK(reader.read("negative_zero", negative_zero));
+	CHECK(negative_zero == 0.0);
+	CHECK(std::signbit(negative_zero));
+
+	int32_t octal = 0;
+	CHECK(reader.read("octal", octal));
+	CHECK(octal == 8);
+
+	double too_large = 0.0;
+	CHECK(reader.read("too_large", too_large));
+	CHECK(too_large == 1e20);
+	CHECK(reader.eof());
+}
+
+TEST_CASE("Binary Reader API", "[binary]")
+{
+	const char* input =
+		"integer = 12\r\n"
+		"exponent = 1e3\r\n"
+		"not_a_number = \"nan\"\r\n"
+		"nothing = null\r\n"
+		"values = [ 1.5, 2, -3.25 ]\r\n"
+		"names = [ \"a\", \"b\" ]\r\n"
+		"child = { flag = false empty = [ ] }\r\n";
+
+	const std::vector<uint8_t> document = compile_c_str(input);
+	BinaryReader reader(document.data(), document.size());
+
+	int16_t integer = 0;
+	CHECK(reader.read("integer", integer));
+	CHECK(integer == 12);
+
+	double exponent = 0.0;
+	CHECK_FALSE(reader.try_read("missing", exponent, 1.0));
+	CHECK(exponent == 1.0);
+	CHECK(reader.try_read("exponent", exponent, 1.0));
+	CHECK(exponent == 1000.0);
+
+	double not_a_number = 0.0;
+	CHECK(reader.read("not_a_number", not_a_number));
+	CHECK(std::isnan(not_a_number));
+
+	StringView nothing;
+	CHECK_FALSE(reader.try_read("nothing", nothing, "default"));
+	CHECK(nothing == "default");
+
+	double values[3];
+	CHECK(reader.read("values", values, 3));
+	CHECK(values[0] == 1.5);
+	CHECK(values[1] == 2.0);
+	CHECK(values[2] == -3.25);
+
+	StringView names[2];
+	CHECK(reader.read("names", names, 2));
+	CHECK(names[0] == "a");
+	CHECK(names[1] == "b");
+
+	CHECK_FALSE(reader.try_object_begins("wrong"));
+	CHECK(reader.is_valid());
+	CHECK(reader.object_begins("child"));
+	bool flag = true;
+	CHECK(reader.read("flag", flag));
+	CHECK_FALSE(flag);
+	CHECK(reader.array_begins("empty"));
+	CHECK(reader.array_ends());
+	CHECK(reader.object_ends());
+
+	CHECK(reader.eof());
+	CHECK(reader.remainder_is_comments_and_whitespace());
+	CHECK(reader.is_valid());
+}
+
+TEST_CASE("Binary Enum Reading", "[binary]")
+{
+	enum class Interpolation { Linear, Step };
+	constexpr EnumEntry<Interpolation> k_interpolations[] = { { "linear", Interpolation::Linear }, { "step", Interpolation::Step } };
+
+	const std::vector<uint8_t> document = compile_c_str("interpolation = \"step\" interpolations = [ \"step\", \"linear\" ] other = \"cubic\"");
+	BinaryReader reader(document.data(), document.size());
+
+	Interpolation interpolation = Interpolation::Linear;
+	CHECK(reader.read_enum("interpolation", interpolation, k_interpolations));
+	CHECK(interpolation == Interpolation::Step);
+
+	Interpolation interpolations[2];
+	CHECK(reader.read_enum("interpolations", interpolations, 2, k_interpolations));
+	CHECK(interpolations[0] == Interpolation::Step);
+	CHECK(interpolations[1] == Interpolation::Linear);
+
+	CHECK_FALSE(reader.read_enum("other", interpolation, k_interpolations));
+	CHECK(reader.get_error().error == ParserError::UnknownEnumValue);
+}
+
+TEST_CASE("Binary Matrix Reading", "[binary]")
+{
+	const std::vector<uint8_t> document = compile_c_str("rotations = [ [ 0.0, 0.0, 0.0, 1.0 ], [ 0.5, 0.5, 0.5, 0.5 ] ] indices = [ [ 1, 2 ], [ 3, 4 ], [ 5, 6 ] ]");
+	BinaryReader reader(document.data(), document.size());
+
+	float rotations[2][4];
+	CHECK(reader.read_matrix("rotations", &rotations[0][0], 4, 2));
+	CHECK(rotations[0][3] == 1.0F);
+	CHECK(rotations[1][0] == 0.5F);
+	CHECK(rotations[1][3] == 0.5F);
+
+	uint16_t indices[6];
+	CHECK_FALSE(reader.read_matrix("indices", indices, 3, 2));
+	CHECK(reader.get_error().error == ParserError::NumberExpected);
+}
+
+TEST_CASE("Binary Half And Normalized Reading", "[binary]")
+{
+	const std::vector<uint8_t> document = compile_c_str("halves = [ 1.0, -2.0, 0.5, 65504.0, 1.0e10 ] normalized = [ -1.0, -0.5, 0.0, 0.5, 1.0, 2.0 ]");
+	BinaryReader reader(document.data(), document.size());
+
+	uint16_t halves[5];
+	CHECK(reader.read_half("halves", halves, 5));
+	CHECK(halves[0] == 0x3C00);
+	CHECK(halves[1] == 0xC000);
+	CHECK(halves[2] == 0x3800);
+	CHECK(halves[3] == 0x7BFF);
+	CHECK(halves[4] == 0x7C00);
+
+	int16_t normalized[6];
+	CHECK(reader.read_normalized("normalized", normalized, 6));
+	CHECK(normalized[0] == -32767);
+	CHECK(normalized[1] == -16384);
+	CHECK(normalized[2] == 0);
+	CHECK(normalized[3] == 16384);
+	CHECK(normalized[4] == 32767);
+	CHECK(normalized[5] == 32767);
+	CHECK(reader.eof());
+}
+
+TEST_CASE("Binary Errors", "[binary]")
+{
+	{
+		const char* input = "key = [ 1, 2";
+		Parser parser(input, std::strlen(input));
+		CHECK(compile_binary(parser, nullptr, 0) == 0);
+		CHECK(parser.get_error().error == ParserError::InputTruncated);
+	}
+
+	{
+		const char* input = "key = nope";
+		Parser parser(input, std::strlen(input));
+		CHECK(compile_binary(parser, nullptr, 0) == 0);
+		CHECK(parser.get_error().error == ParserError::TrueOrFalseExpected);
+	}
+
+	{
+		// 64 levels of nesting compile, 65 are rejected before they can exhaust the stack
+		const std::string deepest = "key = " + std::string(63, '[') + "{ }" + std::string(63, ']');
+		Parser parser(deepest.c_str(), deepest.size());
+		CHECK(compile_binary(parser, nullptr, 0) != 0);
+
+		const std::string too_deep = "key = " + std::string(64, '[') + "{ }" + std::string(64, ']');
+		Parser other_parser(too_deep.c_str(), too_deep.size());
+		CHECK(compile_binary(other_parser, nullptr, 0) == 0);
+		CHECK(other_parser.get_error().error == ParserError::NestingTooDeep);
+
+		const std::string hostile = "key = " + std::string(100000, '[');
+		Parser hostile_parser(hostile.c_str(), hostile.size());
+		CHECK(compile_binary(hostile_parser, nullptr, 0) == 0);
+		CHECK(hostile_parser.get_error().error == ParserError::NestingTooDeep);
+	}
+
+	{
+		const char* input = "key = 12abc";
+		Parser parser(input, std::strlen(input));
+		CHECK(compile_binary(parser, nullptr, 0) == 0);
+		CHECK(parser.get_error().error == ParserError::InvalidNumber);
+	}
+
+	{
+		std::vector<uint8_t> document = compile_c_str("key = \"value\"");
+
+		BinaryReader reader(document.data(), document.size() - 1);
+		CHECK_FALSE(reader.is_valid());
+		CHECK(reader.get_error().error == ParserError::InvalidBinaryDocument);
+
+		// Version mismatch
+		document[4]++;
+		BinaryReader other_reader(document.data(), document.size());
+		CHECK(other_reader.get_error().error == ParserError::InvalidBinaryDocument);
+	}
+
+	{
+		const std::vector<uint8_t> document = compile_c_str("key = \"value\"");
+		BinaryReader reader(document.data(), document.size());
+
+		double value;
+		CHECK_FALSE(reader.read("other", value));
+		CHECK(reader.get_error().error == ParserError::IncorrectKey);
+		reader.reset_state();
+		CHECK_FALSE(reader.read("key", value));
+		CHECK(reader.get_error().error == ParserError::NumberExpected);
+	}
+}
+
+TEST_CASE("Binary Round Trip", "[binary]")
+{
+	StringStreamWriter str_writer;
+	Writer writer(str_writer);
+	writer["string"] = "escaped \"quote\"\n";
+	writer["\"odd key\""] = true;
+	writer["integer"] = int64_t(-5);
+	writer["unsigned"] = uint64_t(18446744073709551615ULL);
+	writer["real"] = 0.1;
+	writer["infinity"] = std::numeric_limits<double>::infinity();
+	writer.insert_null("nothing");
+	writer["object"] = [&](ObjectWriter& object_writer)
+	{
+		object_writer["array"] = [&](ArrayWriter& array_writer)
+		{
+			array_writer.push(1.25);
+			array_writer.push_null();
+			array_writer.push("text");
+			array_writer.push([](ArrayWriter& nested_writer) { nested_writer.push(false); });
+			array_writer.push([](ObjectWriter& element_writer) { element_writer["x"] = int32_t(1); });
+		};
+		object_writer["empty"] = [](ObjectWriter&) {};
+	};
+
+	const std::string input = str_writer.str();
+	const std::vector<uint8_t> document = compile_c_str(input.c_str());
+	CHECK(decompile(document) == input);
+}
@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "catch2.impl.h"
+
+#include <sjson/column_reader.h>
+#include <sjson/parser.h>
+
+#include <cstring>
+
+using namespace sjson;
+
+TEST_CASE("Column Reading", "[column]")
+{
+	{
+		const char* input = "tracks = [ { time = 0.5 value = 3.0 id = 1 name = \"a\" }, { time = 1.0 value = 4.5 id = 2 name = \"b\" }, { time = 1.5 value = -2.0 id = 3 name = \"c\" } ]";
+		Parser parser(input, std::strlen(input));
+
+		float times[4];
+		double values[4];
+		uint16_t ids[4];
+		StringView names[4];
+		const ColumnBinding bindings[] =
+		{
+			column_binding("time", times),
+			column_binding("value", values),
+			column_binding("id", ids),
+			column_binding("name", names),
+		};
+
+		uint32_t num_elements;
+		CHECK(read_columns(parser, "tracks", bindings, 4, num_elements));
+		CHECK(num_elements == 3);
+		CHECK(times[0] == 0.5F);
+		CHECK(times[1] == 1.0F);
+		CHECK(times[2] == 1.5F);
+		CHECK(values[0] == 3.0);
+		CHECK(values[1] == 4.5);
+		CHECK(values[2] == -2.0);
+		CHECK(ids[0] == 1);
+		CHECK(ids[1] == 2);
+		CHECK(ids[2] == 3);
+		CHECK(names[0] == "a");
+		CHECK(names[1] == "b");
+		CHECK(names[2] == "c");
+		CHECK(parser.eof());
+		CHECK(parser.is_valid());
+	}
+
+	{
+		// Members out of order, unknown members, and comments
+		const char* input = "tracks = [ { value = 1.0 time = 2.0 }, { time = 3.0 extra = [ 1, { a = 2 } ] value = 4.0 }, { value = 5.0 // comment\n time = 6.0 } ] next = true";
+		Parser parser(input, std::strlen(input));
+
+		double times[3];
+		double values[3];
+		const ColumnBinding bindings[] = { column_binding("time", times), column_binding("value", values) };
+
+		uint32_t num_elements;
+		CHECK(read_columns(parser, "tracks", bindings, 3, num_elements));
+		CHECK(num_elements == 3);
+		CHECK(times[0] == 2.0);
+		CHECK(times[1] == 3.0);
+		CHECK(times[2] == 6.0);
+		CHECK(values[0] == 1.0);
+		CHECK(values[1] == 4.0);
+		CHECK(values[2] == 5.0);
+
+		bool next;
+		CHECK(parser.read("next", next));
+		CHECK(next);
+		CHECK(parser.is_valid());
+	}
+
+	{
+		const char* input = "tracks = [ ]";
+		Parser parser(input, std::strlen(input));
+
+		bool flags[1];
+		const ColumnBinding bindings[] = { column_binding("flag", flags) };
+
+		uint32_t num_elements = 1;
+		CHECK(read_columns(parser, "tracks", bindings, 1, num_elements));
+		CHECK(num_elements == 0);
+		CHECK(parser.eof());
+	}
+
+	{
+		const char* input = "tracks = [ { time = 1.0 }, { time = 2.0 } ]";
+		Parser parser(input, std::strlen(input));
+
+		double times[1];
+		const ColumnBinding bindings[] = { column_binding("time", times) };
+
+		uint32_t num_elements;
+		CHECK_FALSE(read_columns(parser, "tracks", bindings, 1, num_elements));
+		CHECK(num_elements == 1);
+		CHECK(parser.get_error().error == ParserError::BufferTooSmall);
+	}
+
+	{
+		const char* input = "tracks = [ { time = 1.0 value = 2.0 }, { time = 2.0 } ]";
+		Parser parser(input, std::strlen(input));
+
+		double times[2];
+		double values[2];
+		const ColumnBinding bindings[] = { column_binding("time", times), column_binding("value", values) };
+
+		uint32_t num_elements;
+		CHECK_FALSE(read_columns(parser, "tracks", bindings, 2, num_elements));
+		CHECK(parser.get_error().error == ParserError::RequiredKeyMissing);
+	}
+
+	{
+		const char* input = "tracks = [ { time = \"1.0\" } ]";
+		Parser parser(input, std::strlen(input));
+
+		double times[1];
+		const ColumnBinding bindings[] = { column_binding("time", times) };
+
+		uint32_t num_elements;
+		CHECK_FALSE(read_columns(parser, "tracks", bindings, 1, num_elements));
+		CHECK_FALSE(parser.is_valid());
+	}
+}
@@ -0,0 +1,277 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "catch2.impl.h"
+#include "test_helpers.h"
+
+#include <sjson/document_editor.h>
+#include <sjson/parser.h>
+#include <sjson/writer.h>
+
+#include <cstring>
+#include <string>
+
+using namespace sjson;
+
+namespace
+{
+	const char* k_document =
+		"// Settings\r\n"
+		"version = 2\r\n"
+		"settings = {\r\n"
+		"\tname = \"default\"   // Inline comment\r\n"
+		"\tvalues = [ 1, 2, 3 ]\r\n"
+		"\tempty = [ ]\r\n"
+		"\ttracks = [\r\n"
+		"\t\t{ id = 1 },\r\n"
+		"\t\t{ id = 2 }\r\n"
+		"\t]\r\n"
+		"}\r\n"
+		"/* Trailing comment */\r\n";
+}
+
+TEST_CASE("Document Editor Untouched", "[editor]")
+{
+	StringStreamWriter str_writer;
+	DocumentEditor editor(k_document, std::strlen(k_document), str_writer);
+	CHECK(editor.finish());
+	CHECK(str_writer.str() == k_document);
+}
+
+TEST_CASE("Document Editor Set", "[editor]")
+{
+	StringStreamWriter str_writer;
+	DocumentEditor editor(k_document, std::strlen(k_document), str_writer);
+	CHECK(editor.set("version", 3));
+	CHECK(editor.set("settings.name", "custom \"name\""));
+	CHECK(editor.set("settings.values.1", 2.5));
+	CHECK(editor.set("settings.tracks.1.id", 7));
+	CHECK(editor.finish());
+
+	const std::string expected =
+		"// Settings\r\n"
+		"version = 3\r\n"
+		"settings = {\r\n"
+		"\tname = \"custom \\\"name\\\"\"   // Inline comment\r\n"
+		"\tvalues = [ 1, 2.5, 3 ]\r\n"
+		"\tempty = [ ]\r\n"
+		"\ttracks = [\r\n"
+		"\t\t{ id = 1 },\r\n"
+		"\t\t{ id = 7 }\r\n"
+		"\t]\r\n"
+		"}\r\n"
+		"/* Trailing comment */\r\n";
+	CHECK(str_writer.str() == expected);
+
+	Parser parser(str_writer.str().c_str(), str_writer.str().size());
+	uint32_t version = 0;
+	CHECK(parser.read("version", version));
+	CHECK(version == 3);
+}
+
+TEST_CASE("Document Editor Insert Remove Append", "[editor]")
+{
+	StringStreamWriter str_writer;
+	DocumentEditor editor(k_document, std::strlen(k_document), str_writer);
+	CHECK(editor.remove("version"));
+	CHECK(editor.remove("settings.name"));
+	CHECK(editor.append("settings.values", 4));
+	CHECK(editor.append("settings.empty", "first"));
+	CHECK(editor.insert("settings.tracks.0", "is_enabled", true));
+	CHECK(editor.insert("settings", "quality", 5));
+	CHECK(editor.insert("", "root_key", [](ObjectWriter& writer) { writer["x"] = 1.0; }));
+	CHECK(editor.finish());
+
+	const std::string expected =
+		"// Settings\r\n"
+		"settings = {\r\n"
+		"\tvalues = [ 1, 2, 3, 4 ]\r\n"
+		"\tempty = [ \"first\" ]\r\n"
+		"\ttracks = [\r\n"
+		"\t\t{ id = 1 is_enabled = true },\r\n"
+		"\t\t{ id = 2 }\r\n"
+		"\t]\r\n"
+		"\tquality = 5\r\n"
+		"}\r\n"
+		"/* Trailing comment */\r\n"
+		"root_key = {\r\n"
+		"\tx = 1\r\n"
+		"}\r\n";
+	CHECK(str_writer.str() == expected);
+}
+
+TEST_CASE("Document Editor Layout", "[editor]")
+{
+	StringStreamWriter str_writer;
+	DocumentEditor editor(k_document, std::strlen(k_document), str_writer);
+	CHECK(editor.set("version", [](ObjectWriter& writer) { writer["major"] = 3; }));
+	CHECK(editor.set("settings.values", [](ArrayWriter& writer) { writer.push(1); writer.push(2); }));
+	CHECK(editor.insert("settings.tracks.0", "empty", [](ObjectWriter&) {}));
+	CHECK(editor.append("settings.tracks", [](ObjectWriter& writer) { writer["id"] = 3; }));
+	CHECK(editor.insert("settings", "extra", [](ObjectWriter& writer) { writer["x"] = 1; }));
+	CHECK(editor.finish());
+
+	const std::string expected =
+		"// Settings\r\n"
+		"version = {\r\n"
+		"\tmajor = 3\r\n"
+		"}\r\n"
+		"settings = {\r\n"
+		"\tname = \"default\"   // Inline comment\r\n"
+		"\tvalues = [ 1, 2 ]\r\n"
+		"\tempty = [ ]\r\n"
+		"\ttracks = [\r\n"
+		"\t\t{ id = 1 empty = {\r\n"
+		"\t\t} },\r\n"
+		"\t\t{ id = 2 },\r\n"
+		"\t\t{\r\n"
+		"\t\t\tid = 3\r\n"
+		"\t\t}\r\n"
+		"\t]\r\n"
+		"\textra = {\r\n"
+		"\t\tx = 1\r\n"
+		"\t}\r\n"
+		"}\r\n"
+		"/* Trailing comment */\r\n";
+	CHECK(str_writer.str() == expected);
+
+	Parser parser(str_writer.str().c_str(), str_writer.str().size());
+	CHECK(parser.object_begins("version"));
+	uint32_t major = 0;
+	CHECK(parser.read("major", major));
+	CHECK(major == 3);
+	CHECK(parser.object_ends());
+}
+
+TEST_CASE("Document Editor Edit Order", "[editor]")
+{
+	const char* input = "a = 1\r\nb = { c = [ ] }\r\n";
+
+	std::string name = "first";
+
+	StringStreamWriter str_writer;
+	DocumentEditor editor(input, std::strlen(input), str_writer);
+	CHECK(editor.append("b.c", 2));
+	CHECK(editor.insert("", "d", true));
+	CHECK(editor.set("a", "temporary"));
+	CHECK(editor.insert("b", "e", [&name](ObjectWriter& writer) { writer["name"] = name.c_str(); }));
+	CHECK(editor.append("b.c", 3));
+	CHECK(editor.remove("a"));
+	CHECK(editor.insert("b", "f", 4));
+	CHECK(editor.insert("", "g", false));
+	CHECK(editor.set("a", 5));
+
+	name = "second";
+	CHECK(editor.finish());
+
+	const std::string expected =
+		"a = 5\r\n"
+		"b = { c = [ 2, 3 ] e = {\r\n"
+		"\tname = \"second\"\r\n"
+		"} f = 4 }\r\n"
+		"d = true\r\n"
+		"g = false\r\n";
+	CHECK(str_writer.str() == expected);
+}
+
+TEST_CASE("Document Editor Errors", "[editor]")
+{
+	{
+		StringStreamWriter str_writer;
+		DocumentEditor editor(k_document, std::strlen(k_document), str_writer);
+		CHECK(editor.set("settings.missing", 1));
+		CHECK_FALSE(editor.finish());
+		CHECK(editor.get_error().error == ParserError::PathNotFound);
+	}
+
+	{
+		StringStreamWriter str_writer;
+		DocumentEditor editor(k_document, std::strlen(k_document), str_writer);
+		CHECK(editor.set("settings.values.3", 1));
+		CHECK_FALSE(editor.finish());
+		CHECK(editor.get_error().error == ParserError::PathNotFound);
+	}
+
+	{
+		StringStreamWriter str_writer;
+		DocumentEditor editor(k_document, std::strlen(k_document), str_writer);
+		CHECK(editor.append("settings.name", 1));
+		CHECK_FALSE(editor.finish());
+		CHECK(editor.get_error().error == ParserError::OpeningBracketExpected);
+
+		// Same position as the Parser reports for the opening quotation mark of the value
+		CHECK(editor.get_error().line == 4);
+		CHECK(editor.get_error().column == 10);
+	}
+
+	{
+		StringStreamWriter str_writer;
+		DocumentEditor editor(k_document, std::strlen(k_document), str_writer);
+		CHECK(editor.remove("settings.tracks"));
+		CHECK(editor.set("settings.tracks.1.id", 1));
+		CHECK_FALSE(editor.finish());
+		CHECK(editor.get_error().error == ParserError::EditConflict);
+		CHECK(editor.get_error().line == 9);
+	}
+
+	{
+		StringStreamWriter str_writer;
+		DocumentEditor editor(k_document, std::strlen(k_document), str_writer);
+		CHECK(editor.set("settings.tracks.1", 1));
+		CHECK(editor.insert("settings.tracks.1", "key", 2));
+		CHECK_FALSE(editor.finish());
+		CHECK(editor.get_error().error == ParserError::EditConflict);
+	}
+
+	{
+		StringStreamWriter str_writer;
+		DocumentEditor editor(k_document, std::strlen(k_document), str_writer);
+		for (uint32_t edit_index = 0; edit_index < DocumentEditor::k_max_num_edits; ++edit_index)
+			CHECK(editor.append("settings.values", edit_index));
+
+		CHECK_FALSE(editor.append("settings.values", 0));
+		CHECK(editor.get_error().error == ParserError::TooManyEdits);
+	}
+
+	{
+		const char* input = "key = [ 1, 2";
+		StringStreamWriter str_writer;
+		DocumentEditor editor(input, std::strlen(input), str_writer);
+		CHECK(editor.append("key", 3));
+		CHECK_FALSE(editor.finish());
+		CHECK(editor.get_error().error == ParserError::InputTruncated);
+	}
+
+	{
+		// Paths are only resolved by finish(), the first edit that cannot be made is reported
+		StringStreamWriter str_writer;
+		DocumentEditor editor(k_document, std::strlen(k_document), str_writer);
+		CHECK(editor.set("settings.name.first", 1));
+		CHECK(editor.append("settings", 1));
+		CHECK_FALSE(editor.finish());
+		CHECK(editor.get_error().error == ParserError::PathNotFound);
+		CHECK(editor.get_error().line == 4);
+		CHECK(editor.get_error().column == 10);
+	}
+}
@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "catch2.impl.h"
+
+#include <sjson/event_parser.h>
+#include <sjson/parser.h>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+
+using namespace sjson;
+
+namespace
+{
+	class RecordingVisitor final : public ParseVisitor
+	{
+	public:
+		virtual void on_object_begin() override { m_events += "{ "; }
+		virtual void on_object_end() override { m_events += "} "; }
+		virtual void on_array_begin() override { m_events += "[ "; }
+		virtual void on_array_end() override { m_events += "] "; }
+		virtual void on_key(const StringView& key) override { m_events += "key:" + std::string(key.c_str(), key.size()) + " "; }
+		virtual void on_string(const StringView& value) override { m_events += "str:" + std::string(value.c_str(), value.size()) + " "; }
+		virtual void on_number(const StringView& value) override { m_events += "num:" + std::string(value.c_str(), value.size()) + " "; }
+		virtual void on_bool(bool value) override { m_events += value ? "true " : "false "; }
+		virtual void on_null() override { m_events += "null "; }
+
+		const std::string& get_events() const { return m_events; }
+
+	private:
+		std::string m_events;
+	};
+
+	class KeyCountingVisitor final : public ParseVisitor
+	{
+	public:
+		virtual void on_key(const StringView& key) override { (void)key; num_keys++; }
+
+		uint32_t num_keys = 0;
+	};
+}
+
+TEST_CASE("Event Parser Events", "[visitor]")
+{
+	const char* document =
+		"// Clip\r\n"
+		"name = \"walk \\\"fast\\\"\"\r\n"
+		"\"quoted key\" = null\r\n"
+		"clip = {\r\n"
+		"\trate = 30 /* fps */\r\n"
+		"\tscale = -1.5e3\r\n"
+		"\tbits = 0x1p-2\r\n"
+		"\tempty = { }\r\n"
+		"\ttracks = [\r\n"
+		"\t\t[ ],\r\n"
+		"\t\t[ true, false, null ],\r\n"
+		"\t\t{ id = 1 }\r\n"
+		"\t]\r\n"
+		"}\r\n";
+
+	RecordingVisitor visitor;
+	Parser parser(document, std::strlen(document));
+	EventParser event_parser(parser, visitor);
+	CHECK(event_parser.run());
+	CHECK(parser.eof());
+
+	const std::string expected =
+		"key:name str:walk \\\"fast\\\" "
+		"key:quoted key null "
+		"key:clip { key:rate num:30 key:scale num:-1.5e3 key:bits num:0x1p-2 key:empty { } "
+		"key:tracks [ [ ] [ true false null ] { key:id num:1 } ] } ";
+	CHECK(visitor.get_events() == expected);
+
+	// Events we do not override are ignored
+	KeyCountingVisitor counting_visitor;
+	Parser counting_parser(document, std::strlen(document));
+	EventParser counting_event_parser(counting_parser, counting_visitor);
+	CHECK(counting_event_parser.run());
+	CHECK(counting_visitor.num_keys == 9);
+}
+
+TEST_CASE("Event Parser Budgeted Walk", "[visitor]")
+{
+	std::string document = "name = \"clip\" tracks = [ ";
+	for (uint32_t i = 0; i < 100; ++i)
+	{
+		if (i != 0)
+			document += ", ";
+		document += "{ id = " + std::to_string(i) + " weight = 0.5 }";
+	}
+	document += " ] // done\r\n";
+
+	RecordingVisitor expected_visitor;
+	Parser expected_parser(document.c_str(), document.size());
+	EventParser expected_event_parser(expected_parser, expected_visitor);
+	CHECK(expected_event_parser.run());
+	CHECK(expected_event_parser.is_done());
+
+	{
+		RecordingVisitor visitor;
+		Parser parser(document.c_str(), document.size());
+		EventParser event_parser(parser, visitor);
+
+		// At least one token is consumed every call, even with no budget
+		uint32_t num_calls = 0;
+		while (!event_parser.is_done())
+		{
+			CHECK(event_parser.run_for(size_t(0)));
+			num_calls++;
+		}
+
+		CHECK(num_calls > 100);
+		CHECK(visitor.get_events() == expected_visitor.get_events());
+		CHECK(parser.eof());
+
+		CHECK(event_parser.run_for(size_t(16)));
+		CHECK(event_parser.is_done());
+	}
+
+	{
+		RecordingVisitor visitor;
+		Parser parser(document.c_str(), document.size());
+		EventParser event_parser(parser, visitor);
+
+		uint32_t num_calls = 0;
+		size_t previous_size = 0;
+		while (!event_parser.is_done())
+		{
+			CHECK(event_parser.run_for(size_t(64)));
+			CHECK(visitor.get_events().size() > previous_size);
+			previous_size = visitor.get_events().size();
+			num_calls++;
+		}
+
+		CHECK(num_calls > 1);
+		CHECK(visitor.get_events() == expected_visitor.get_events());
+	}
+
+	{
+		RecordingVisitor visitor;
+		Parser parser(document.c_str(), document.size());
+		EventParser event_parser(parser, visitor);
+
+		uint32_t num_calls = 0;
+		while (!event_parser.is_done())
+		{
+			CHECK(event_parser.run_for(std::chrono::nanoseconds(0)));
+			num_calls++;
+		}
+
+		CHECK(num_calls > 1);
+		CHECK(visitor.get_events() == expected_visitor.get_events());
+	}
+
+	{
+		const char* invalid_document = "a = 1 b = 2 c = [ 1 2 ]";
+		RecordingVisitor visitor;
+		Parser parser(invalid_document, std::strlen(invalid_document));
+		EventParser event_parser(parser, visitor);
+
+		CHECK(event_parser.run_for(size_t(4)));
+		CHECK_FALSE(event_parser.is_done());
+		CHECK_FALSE(event_parser.run_for(std::chrono::seconds(1)));
+		CHECK(parser.get_error().error == ParserError::CommaExpected);
+	}
+}
+
+TEST_CASE("Event Parser Invalid Input", "[visitor]")
+{
+	{
+		const char* document = "values = [ 1 2 ]";
+		RecordingVisitor visitor;
+		Parser parser(document, std::strlen(document));
+		EventParser event_parser(parser, visitor);
+		CHECK_FALSE(event_parser.run());
+		CHECK(parser.get_error().error == ParserError::CommaExpected);
+		CHECK(visitor.get_events() == "key:values [ num:1 ");
+	}
+
+	{
+		const char* document = "value = nope";
+		RecordingVisitor visitor;
+		Parser parser(document, std::strlen(document));
+		EventParser event_parser(parser, visitor);
+		CHECK_FALSE(event_parser.run());
+		CHECK(parser.get_error().error == ParserError::TrueOrFalseExpected);
+	}
+
+	{
+		const char* document = "object = { value = 1";
+		RecordingVisitor visitor;
+		Parser parser(document, std::strlen(document));
+		EventParser event_parser(parser, visitor);
+		CHECK_FALSE(event_parser.run());
+		CHECK(parser.get_error().error == ParserError::InputTruncated);
+	}
+
+	{
+		std::string document = "value = ";
+		for (uint32_t depth = 0; depth <= EventParser::k_max_depth; ++depth)
+			document += "[ ";
+
+		RecordingVisitor visitor;
+		Parser parser(document.c_str(), document.size());
+		EventParser event_parser(parser, visitor);
+		CHECK_FALSE(event_parser.run());
+		CHECK(parser.get_error().error == ParserError::NestingTooDeep);
+	}
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <sjson/parser.h>
+#include <sjson/writer.h>
+
+#include <cstring>
+#include <string>
+
+namespace sjson
+{
+	// Collects everything written into a string
+	class StringStreamWriter final : public StreamWriter
+	{
+	public:
+		StringStreamWriter() = default;
+		StringStreamWriter(const StringStreamWriter&) = delete;
+		StringStreamWriter& operator=(const StringStreamWriter&) = delete;
+
+		virtual void write(const void* buffer, size_t buffer_size) override { m_buffer.append(static_cast<const char*>(buffer), buffer_size); }
+
+		const std::string& str() const { return m_buffer; }
+
+	private:
+		std::string m_buffer;
+	};
+
+	inline Parser parser_from_c_str(const char* c_str)
+	{
+		return Parser(c_str, c_str != nullptr ? std::strlen(c_str) : 0);
+	}
+}
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "catch2.impl.h"
+
+#include <sjson/number_token.h>
+
+#include <cstdint>
+
+using namespace sjson;
+
+TEST_CASE("Number Token Conversion", "[number]")
+{
+	{
+		double value = 0.0;
+		CHECK(to_double("-1.5e3", value));
+		CHECK(value == -1500.0);
+		CHECK(to_double("0x1.8p+1", value));
+		CHECK(value == 3.0);
+		CHECK(to_double("-0x1p-2", value));
+		CHECK(value == -0.25);
+		CHECK_FALSE(to_double("1.5x", value));
+		CHECK_FALSE(to_double("", value));
+		CHECK_FALSE(to_double("0x1q", value));
+	}
+
+	{
+		float value = 0.0F;
+		CHECK(to_float("0.5", value));
+		CHECK(value == 0.5F);
+		CHECK(to_float("0x1.8p+1", value));
+		CHECK(value == 3.0F);
+		CHECK_FALSE(to_float("abc", value));
+	}
+
+	{
+		int32_t value = 0;
+		CHECK(to_int("-123", value));
+		CHECK(value == -123);
+		CHECK(to_int("0x1F", value));
+		CHECK(value == 31);
+		CHECK(to_int("017", value));
+		CHECK(value == 15);
+		CHECK_FALSE(to_int("1.5", value));
+		CHECK_FALSE(to_int("4294967296", value));
+
+		uint8_t small_value = 0;
+		CHECK(to_int("255", small_value));
+		CHECK(small_value == 255);
+		CHECK_FALSE(to_int("256", small_value));
+		CHECK_FALSE(to_int("-1", small_value));
+
+		int64_t large_value = 0;
+		CHECK(to_int("-9223372036854775808", large_value));
+		CHECK(large_value == INT64_MIN);
+		CHECK_FALSE(to_int("9223372036854775808", large_value));
+
+		uint64_t unsigned_value = 0;
+		CHECK(to_int("18446744073709551615", unsigned_value));
+		CHECK(unsigned_value == UINT64_MAX);
+		CHECK_FALSE(to_int("18446744073709551616", unsigned_value));
+	}
+}
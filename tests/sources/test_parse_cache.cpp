@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "catch2.impl.h"
+
+#include <sjson/binary_compiler.h>
+#include <sjson/binary_reader.h>
+#include <sjson/parse_cache.h>
+#include <sjson/parser.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace sjson;
+
+TEST_CASE("Parse Cache Key", "[parse_cache]")
+{
+	const char* input = "key = \"value\"\r\nother = 123\r\n";
+	const size_t input_size = std::strlen(input);
+
+	const ParseCacheKey key = compute_parse_cache_key(input, input_size);
+	CHECK(key.input_size == input_size);
+	CHECK(key.input_hash == compute_parse_cache_key(input, input_size).input_hash);
+
+	// Every prefix and every single byte change must produce a different hash
+	std::vector<char> modified_input(input, input + input_size);
+	for (size_t size = 0; size < input_size; ++size)
+		CHECK(compute_parse_cache_key(input, size).input_hash != key.input_hash);
+
+	for (size_t offset = 0; offset < input_size; ++offset)
+	{
+		modified_input[offset]++;
+		CHECK(compute_parse_cache_key(modified_input.data(), input_size).input_hash != key.input_hash);
+		modified_input[offset]--;
+	}
+}
+
+TEST_CASE("Parse Cache Reading and Writing", "[parse_cache]")
+{
+	const char* cache_path = "sjson_test_parse_cache.bin";
+	const char* input = "key = \"value\"\r\nother = 123\r\n";
+	const size_t input_size = std::strlen(input);
+	const ParseCacheKey key = compute_parse_cache_key(input, input_size);
+
+	std::remove(cache_path);
+	CHECK(read_parse_cache(cache_path, key, nullptr, 0) == 0);
+
+	Parser parser(input, input_size);
+	std::vector<uint8_t> document(compile_binary(parser, nullptr, 0));
+	parser.reset_state();
+	REQUIRE(compile_binary(parser, document.data(), document.size()) == document.size());
+	REQUIRE(write_parse_cache(cache_path, key, document.data(), document.size()));
+
+	{
+		CHECK(read_parse_cache(cache_path, key, nullptr, 0) == document.size());
+
+		// A hit with a buffer too small is a miss, nothing is read
+		std::vector<uint8_t> small_buffer(document.size() - 1, 0xCD);
+		CHECK(read_parse_cache(cache_path, key, small_buffer.data(), small_buffer.size()) == 0);
+		CHECK(std::count(small_buffer.begin(), small_buffer.end(), 0xCD) == static_cast<std::ptrdiff_t>(small_buffer.size()));
+
+		std::vector<uint8_t> cached_document(document.size());
+		CHECK(read_parse_cache(cache_path, key, cached_document.data(), cached_document.size()) == document.size());
+		CHECK(cached_document == document);
+
+		BinaryReader reader(cached_document.data(), cached_document.size());
+		StringView value;
+		uint32_t other;
+		CHECK(reader.read("key", value));
+		CHECK(value == "value");
+		CHECK(reader.read("other", other));
+		CHECK(other == 123);
+		CHECK(reader.eof());
+	}
+
+	{
+		// A different input is a miss
+		const ParseCacheKey other_key = compute_parse_cache_key(input, input_size - 1);
+		CHECK(read_parse_cache(cache_path, other_key, nullptr, 0) == 0);
+	}
+
+	{
+		// Read the whole file like a memory mapped view
+		std::FILE* file = sjson_impl::open_file(cache_path, "rb");
+		REQUIRE(file != nullptr);
+		std::vector<uint8_t> cache_data(1024);
+		cache_data.resize(std::fread(cache_data.data(), 1, cache_data.size(), file));
+		std::fclose(file);
+
+		size_t document_size;
+		const void* cached_document = find_cached_document(cache_data.data(), cache_data.size(), key, document_size);
+		REQUIRE(cached_document != nullptr);
+		CHECK(document_size == document.size());
+		CHECK(std::memcmp(cached_document, document.data(), document_size) == 0);
+
+		CHECK(find_cached_document(cache_data.data(), cache_data.size() - 1, key, document_size) == nullptr);
+		CHECK(document_size == 0);
+
+		// Version mismatch
+		cache_data[4]++;
+		CHECK(find_cached_document(cache_data.data(), cache_data.size(), key, document_size) == nullptr);
+	}
+
+	{
+		// The cache is written to a temporary file that is renamed into place, an existing cache is replaced
+		REQUIRE(write_parse_cache(cache_path, key, document.data(), document.size()));
+		CHECK(read_parse_cache(cache_path, key, nullptr, 0) == document.size());
+		CHECK(sjson_impl::open_file("sjson_test_parse_cache.bin.tmp", "rb") == nullptr);
+
+		// Nothing is written for an empty document, the previous cache is kept
+		CHECK_FALSE(write_parse_cache(cache_path, key, document.data(), 0));
+		CHECK(read_parse_cache(cache_path, key, nullptr, 0) == document.size());
+	}
+
+	std::remove(cache_path);
+}
@@ -23,15 +23,17 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "catch2.impl.h"
+#include "test_helpers.h"
 
 #include <sjson/parser.h>
+#include <sjson/writer.h>
 
-using namespace sjson;
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
 
-static Parser parser_from_c_str(const char* c_str)
-{
-	return Parser(c_str, c_str != nullptr ? std::strlen(c_str) : 0);
-}
+using namespace sjson;
 
 TEST_CASE("Parser Misc", "[parser]")
 {
@@ -569,6 +571,168 @@ TEST_CASE("Parser Number Reading", "[parser]")
 	}
 }
 
+TEST_CASE("Parser Hexadecimal Float Reading", "[parser]")
+{
+	{
+		Parser parser = parser_from_c_str("key0 = 0x1.9p+3 key1 = -0x1p-2 key2 = 0x0p+0 key3 = 0X1.8P1 key4 = 0x10");
+		double value0 = 0.0;
+		double value1 = 0.0;
+		double value2 = 1.0;
+		float value3 = 0.0F;
+		double value4 = 0.0;
+		CHECK(parser.read("key0", value0));
+		CHECK(value0 == 12.5);
+		CHECK(parser.read("key1", value1));
+		CHECK(value1 == -0.25);
+		CHECK(parser.read("key2", value2));
+		CHECK(value2 == 0.0);
+		CHECK(parser.read("key3", value3));
+		CHECK(value3 == 3.0F);
+		CHECK(parser.read("key4", value4));
+		CHECK(value4 == 16.0);
+		CHECK(parser.eof());
+		CHECK(parser.is_valid());
+	}
+
+	{
+		Parser parser = parser_from_c_str("key = [ 0x1p+0, -0x1.8p+1 ]");
+		double values[2] = { 0.0, 0.0 };
+		CHECK(parser.read("key", values, 2));
+		CHECK(values[0] == 1.0);
+		CHECK(values[1] == -3.0);
+		CHECK(parser.is_valid());
+	}
+
+	{
+		Parser parser = parser_from_c_str("key = 0x.p+3");
+		double value = 0.0;
+		CHECK_FALSE(parser.read("key", value));
+		CHECK_FALSE(parser.is_valid());
+	}
+
+	{
+		Parser parser = parser_from_c_str("key = 0x1p+");
+		double value = 0.0;
+		CHECK_FALSE(parser.read("key", value));
+		CHECK(parser.get_error().error == ParserError::InvalidNumber);
+	}
+
+	// Extreme values and rounding
+	{
+		double value = 0.0;
+		CHECK(sjson_impl::parse_hex_double("0x1.fffffffffffffp+1023", 23, value));
+		CHECK(value == std::numeric_limits<double>::max());
+		CHECK(sjson_impl::parse_hex_double("0x1p-1074", 9, value));
+		CHECK(value == std::numeric_limits<double>::denorm_min());
+		CHECK(sjson_impl::parse_hex_double("0x1p-1075", 9, value));
+		CHECK(value == 0.0);		// Tie rounds to even
+		CHECK(sjson_impl::parse_hex_double("0x1.8p-1074", 11, value));
+		CHECK(value == 2.0 * std::numeric_limits<double>::denorm_min());
+		CHECK(sjson_impl::parse_hex_double("0x1.00000000000008p+0", 21, value));
+		CHECK(value == 1.0);		// Tie rounds to even
+		CHECK(sjson_impl::parse_hex_double("0x1.00000000000018p+0", 21, value));
+		CHECK(value == 1.0 + 2.0 * std::numeric_limits<double>::epsilon());
+		CHECK(sjson_impl::parse_hex_double("0x1.000000000000080001p+0", 25, value));
+		CHECK(value == 1.0 + std::numeric_limits<double>::epsilon());
+		CHECK(sjson_impl::parse_hex_double("0x1p+1024", 9, value));
+		CHECK(std::isinf(value));
+	}
+
+	// Round trip
+	{
+		const double values[] = { 0.1, -123.456, 1.0e-310, std::numeric_limits<double>::min(), std::numeric_limits<double>::max(), std::numeric_limits<double>::denorm_min(), -0.0, 3.0 };
+
+		for (double value : values)
+		{
+			char buffer[sjson_impl::k_max_hex_double_length];
+			const size_t length = sjson_impl::format_hex_double(value, buffer);
+
+			double result = 0.0;
+			CHECK(sjson_impl::parse_hex_double(buffer, length, result));
+			CHECK(std::memcmp(&value, &result, sizeof(double)) == 0);
+
+			const double strtod_result = std::strtod(std::string(buffer, length).c_str(), nullptr);
+			CHECK(std::memcmp(&value, &strtod_result, sizeof(double)) == 0);
+		}
+
+		uint64_t seed = 0x9E3779B97F4A7C15ULL;
+		for (uint32_t iteration = 0; iteration < 10000; ++iteration)
+		{
+			seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+			double value;
+			std::memcpy(&value, &seed, sizeof(double));
+			if (!std::isfinite(value))
+				continue;
+
+			char buffer[sjson_impl::k_max_hex_double_length];
+			const size_t length = sjson_impl::format_hex_double(value, buffer);
+
+			double result = 0.0;
+			CHECK(sjson_impl::parse_hex_double(buffer, length, result));
+			CHECK(std::memcmp(&value, &result, sizeof(double)) == 0);
+		}
+	}
+}
+
+TEST_CASE("Parser Blob Reading", "[parser]")
+{
+	{
+		Parser parser = parser_from_c_str("floats = \"AAAgQQAAoEA=\" integers = \"AQD+/wMA\" text = \"aGVsbG8gd29ybGQhIQ==\" empty = \"\"");
+		float values[2] = { 0.0F, 0.0F };
+		int16_t integers[3] = { 0, 0, 0 };
+		char text[13];
+		CHECK(parser.read_blob("floats", values, 2));
+		CHECK(values[0] == 10.0F);
+		CHECK(values[1] == 5.0F);
+		CHECK(parser.read_blob("integers", integers, 3));
+		CHECK(integers[0] == 1);
+		CHECK(integers[1] == -2);
+		CHECK(integers[2] == 3);
+		CHECK(parser.read_blob("text", text, sizeof(text)));
+		CHECK(std::memcmp(text, "hello world!!", sizeof(text)) == 0);
+		CHECK(parser.read_blob("empty", text, 0));
+		CHECK(parser.eof());
+		CHECK(parser.is_valid());
+	}
+
+	{
+		Parser parser = parser_from_c_str("key = \"AAAgQQAAoEA=\"");
+		float values[3];
+		CHECK_FALSE(parser.read_blob("key", values, 3));
+		CHECK(parser.get_error().error == ParserError::InvalidBlob);
+	}
+
+	{
+		Parser parser = parser_from_c_str("key = \"AAAgQQAAo*A=\"");
+		float values[2];
+		CHECK_FALSE(parser.read_blob("key", values, 2));
+		CHECK(parser.get_error().error == ParserError::InvalidBlob);
+	}
+
+	// Every size and every invalid character position to cover the SIMD and scalar paths
+	for (size_t size = 0; size < 100; ++size)
+	{
+		uint8_t data[100];
+		for (size_t i = 0; i < size; ++i)
+			data[i] = static_cast<uint8_t>(i * 37 + size);
+
+		std::string encoded(sjson_impl::get_base64_encoded_size(size), '\0');
+		CHECK(sjson_impl::encode_base64(data, size, &encoded[0]) == encoded.size());
+
+		uint8_t decoded[100];
+		CHECK(sjson_impl::decode_base64(encoded.c_str(), encoded.size(), decoded, size));
+		CHECK(std::memcmp(data, decoded, size) == 0);
+
+		for (size_t i = 0; i < encoded.size(); ++i)
+		{
+			std::string corrupted = encoded;
+			corrupted[i] = '\xC3';
+			CHECK_FALSE(sjson_impl::decode_base64(corrupted.c_str(), corrupted.size(), decoded, size));
+		}
+	}
+}
+
 TEST_CASE("Parser Array Reading", "[parser]")
 {
 	{
@@ -664,3 +828,576 @@ TEST_CASE("Parser Null Reading", "[parser]")
 		CHECK(parser.is_valid());
 	}
 }
+
+TEST_CASE("Parser Peeking", "[parser]")
+{
+	{
+		Parser parser = parser_from_c_str("// Comment\nkey0 = { } \"key 1\" = [ 1 ] key2 = \"str\" key3 = -1.5 key4 = true key5 = null");
+
+		StringView key;
+		CHECK(parser.peek_key(key));
+		CHECK(key == "key0");
+		CHECK(parser.peek_value_type() == ValueType::Object);
+		CHECK(parser.object_begins("key0"));
+		CHECK(parser.object_ends());
+
+		CHECK(parser.peek_key(key));
+		CHECK(key == "key 1");
+		CHECK(parser.peek_value_type() == ValueType::Array);
+		CHECK(parser.array_begins("key 1"));
+		CHECK(parser.peek_value_type() == ValueType::Number);
+		double value = 0.0;
+		CHECK(parser.read(&value, 1));
+		CHECK(parser.array_ends());
+
+		const char* expected_keys[] = { "key2", "key3", "key4", "key5" };
+		const ValueType expected_types[] = { ValueType::String, ValueType::Number, ValueType::Bool, ValueType::Null };
+		for (size_t i = 0; i < 4; ++i)
+		{
+			CHECK(parser.peek_key(key));
+			CHECK(key == expected_keys[i]);
+			CHECK(parser.peek_value_type() == expected_types[i]);
+
+			// Peeking does not consume anything, the whole member is skipped
+			CHECK(parser.peek_key(key));
+			CHECK(parser.skip_member());
+		}
+
+		CHECK_FALSE(parser.peek_key(key));
+		CHECK(parser.peek_value_type() == ValueType::Invalid);
+		CHECK(parser.eof());
+		CHECK(parser.is_valid());
+	}
+
+	{
+		Parser parser = parser_from_c_str("key = ");
+
+		StringView key;
+		CHECK(parser.peek_key(key));
+		CHECK(key == "key");
+		CHECK(parser.peek_value_type() == ValueType::Invalid);
+		CHECK(parser.is_valid());
+	}
+}
+
+TEST_CASE("Parser Number Token Reading", "[parser]")
+{
+	{
+		Parser parser = parser_from_c_str("key0 = -1.5e3 key1 = 0x1.8p+1 key2 = 0 key3 = [ 12, 0x1F ]");
+
+		StringView value;
+		CHECK(parser.read_number_token("key0", value));
+		CHECK(value == "-1.5e3");
+		CHECK(parser.read_number_token("key1", value));
+		CHECK(value == "0x1.8p+1");
+		CHECK(parser.read_number_token("key2", value));
+		CHECK(value == "0");
+		CHECK(parser.array_begins("key3"));
+		CHECK(parser.read_number_token(value));
+		CHECK(value == "12");
+		CHECK(parser.read_comma());
+		CHECK(parser.read_number_token(value));
+		CHECK(value == "0x1F");
+		CHECK(parser.array_ends());
+		CHECK(parser.eof());
+		CHECK(parser.is_valid());
+	}
+
+	const char* invalid_documents[] = { "key = -", "key = 1e", "key = 1.5.2", "key = 0x", "key = 0x1p", "key = 12abc", "key = \"12\"" };
+	const uint32_t expected_errors[] = { ParserError::NumberExpected, ParserError::InvalidNumber, ParserError::InvalidNumber, ParserError::InvalidNumber, ParserError::InvalidNumber, ParserError::InvalidNumber, ParserError::NumberExpected };
+	for (size_t i = 0; i < 7; ++i)
+	{
+		Parser parser = parser_from_c_str(invalid_documents[i]);
+
+		StringView value;
+		CHECK_FALSE(parser.read_number_token("key", value));
+		CHECK(parser.get_error().error == expected_errors[i]);
+	}
+}
+
+TEST_CASE("Parser Malformed Number Skipping", "[parser]")
+{
+	const char* invalid_documents[] = { "key = -", "key = 1-2-3", "key = 1e", "key = 0x1p", "key = [ 1.5.2 ]", "key = { a = 12abc }" };
+	for (size_t i = 0; i < 6; ++i)
+	{
+		Parser parser = parser_from_c_str(invalid_documents[i]);
+
+		bool is_skipped = true;
+		while (is_skipped && !parser.eof())
+			is_skipped = parser.skip_member();
+
+		CHECK_FALSE(is_skipped);
+		CHECK_FALSE(parser.is_valid());
+	}
+}
+
+TEST_CASE("Parser Deep Nesting Skipping", "[parser]")
+{
+	// The innermost empty object is one more level
+	for (uint32_t depth = Parser::k_max_skip_depth - 1; depth <= Parser::k_max_skip_depth; ++depth)
+	{
+		std::string document = "key = ";
+		for (uint32_t level = 0; level < depth; ++level)
+			document += (level % 2) == 0 ? "[ 1, " : "{ a = 1 b = ";
+
+		document += "{ }";
+		for (uint32_t level = depth; level > 0; --level)
+			document += ((level - 1) % 2) == 0 ? " ]" : " }";
+
+		document += " next = 2";
+
+		Parser parser(document.c_str(), document.size());
+		if (depth < Parser::k_max_skip_depth)
+		{
+			CHECK(parser.skip_member());
+		}
+		else
+		{
+			CHECK_FALSE(parser.skip_member());
+			CHECK(parser.get_error().error == ParserError::NestingTooDeep);
+		}
+	}
+
+	{
+		// Far deeper than the stack could handle with one call per level
+		const std::string document = "key = " + std::string(100000, '[');
+
+		Parser parser(document.c_str(), document.size());
+		CHECK_FALSE(parser.skip_member());
+		CHECK(parser.get_error().error == ParserError::NestingTooDeep);
+	}
+
+	{
+		Parser parser = parser_from_c_str("key = { a = [ 1, [ ], { } ] b = { c = { } } } next = [ { d = \"}\" } ]");
+		CHECK(parser.skip_member());
+		CHECK(parser.array_begins("next"));
+		CHECK(parser.object_begins());
+		StringView str;
+		CHECK(parser.read("d", str));
+		CHECK(str == "}");
+		CHECK(parser.object_ends());
+		CHECK(parser.array_ends());
+		CHECK(parser.eof());
+	}
+}
+
+TEST_CASE("Parser Key Reading", "[parser]")
+{
+	constexpr Key k_sample_rate("sample_rate");
+	static_assert(k_sample_rate.size() == 11, "Key length is computed at compile time");
+	CHECK(k_sample_rate.get_hash() == sjson_impl::hash_key_runtime("sample_rate", 11));
+
+	{
+		Parser parser = parser_from_c_str("sample_rate = 30 \"quoted key\" = true name = \"walk\"");
+
+		uint32_t sample_rate = 0;
+		CHECK_FALSE(parser.try_read(Key("sample_bits"), sample_rate, 0));
+		CHECK(parser.read(k_sample_rate, sample_rate));
+		CHECK(sample_rate == 30);
+
+		bool value = false;
+		CHECK(parser.read(Key("quoted key", 10), value));
+		CHECK(value == true);
+
+		// Character arrays stop at their null terminator
+		char name_key[16] = "name";
+		StringView name;
+		CHECK(parser.read(name_key, name));
+		CHECK(name == "walk");
+		CHECK(parser.eof());
+		CHECK(parser.is_valid());
+	}
+
+	{
+		Parser parser = parser_from_c_str("key0 = 1");
+
+		const char* key = "key1";
+		uint32_t value = 0;
+		CHECK_FALSE(parser.read(key, value));
+		CHECK(parser.get_error().error == ParserError::IncorrectKey);
+	}
+
+	{
+		// Keys escaped by the writer match once unescaped
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer["a\"b"] = int32_t(1);
+		writer["a\\b"] = int32_t(2);
+		writer["\xC3\xA9\tc"] = int32_t(3);
+
+		const std::string document = str_writer.str();
+		Parser parser(document.c_str(), document.size());
+
+		int32_t value = 0;
+		CHECK_FALSE(parser.read("a\\\"b", value));
+		CHECK(parser.get_error().error == ParserError::IncorrectKey);
+		parser.reset_state();
+		CHECK(parser.read("a\"b", value));
+		CHECK(value == 1);
+		CHECK_FALSE(parser.read("a\\\\b", value));
+		parser.reset_state();
+		parser.read("a\"b", value);
+		CHECK(parser.read("a\\b", value));
+		CHECK(value == 2);
+		CHECK(parser.read("\xC3\xA9\tc", value));
+		CHECK(value == 3);
+		CHECK(parser.is_valid());
+	}
+}
+
+namespace
+{
+	enum class TrackType
+	{
+		Rotation,
+		Translation,
+		Scale,
+	};
+
+	constexpr EnumEntry<TrackType> k_track_types[] =
+	{
+		{ "rotation", TrackType::Rotation },
+		{ "translation", TrackType::Translation },
+		{ "scale", TrackType::Scale },
+	};
+}
+
+TEST_CASE("Parser Enum Reading", "[parser]")
+{
+	{
+		Parser parser = parser_from_c_str("type = \"translation\" types = [ \"scale\", \"rotation\" ] other = null");
+
+		TrackType type = TrackType::Rotation;
+		CHECK(parser.read_enum("type", type, k_track_types));
+		CHECK(type == TrackType::Translation);
+
+		TrackType types[2];
+		CHECK(parser.read_enum("types", types, 2, k_track_types));
+		CHECK(types[0] == TrackType::Scale);
+		CHECK(types[1] == TrackType::Rotation);
+
+		CHECK_FALSE(parser.try_read_enum("missing", type, k_track_types, TrackType::Scale));
+		CHECK(type == TrackType::Scale);
+		CHECK_FALSE(parser.try_read_enum("other", type, k_track_types, TrackType::Rotation));
+		CHECK(type == TrackType::Rotation);
+		CHECK(parser.eof());
+		CHECK(parser.is_valid());
+	}
+
+	{
+		Parser parser = parser_from_c_str("type = \"rotations\"");
+
+		TrackType type = TrackType::Scale;
+		CHECK_FALSE(parser.read_enum("type", type, k_track_types));
+		CHECK(type == TrackType::Scale);
+		CHECK(parser.get_error().error == ParserError::UnknownEnumValue);
+		CHECK(parser.get_error().column == 8);
+	}
+
+	{
+		Parser parser = parser_from_c_str("type = 1");
+
+		TrackType type = TrackType::Scale;
+		CHECK_FALSE(parser.read_enum("type", type, k_track_types));
+		CHECK(parser.get_error().error == ParserError::QuotationMarkExpected);
+	}
+}
+
+TEST_CASE("Parser Unescaped String Reading", "[parser]")
+{
+	const char* document = "clean = \"no escapes\" escaped = \"a \\\"quoted\\\" \\\\ path\\nwith \\u00E9 and \\uD83D\\uDE00\" empty = \"\"";
+	const char* expected_escaped = "a \"quoted\" \\ path\nwith \xC3\xA9 and \xF0\x9F\x98\x80";
+
+	{
+		Parser parser = parser_from_c_str(document);
+
+		char buffer[64];
+		StringView value;
+		CHECK(parser.read_unescaped("clean", buffer, sizeof(buffer), value));
+		CHECK(value == "no escapes");
+		CHECK(value.c_str() > document);	// Points into the input, not the buffer
+		CHECK(value.c_str() < document + std::strlen(document));
+
+		CHECK(parser.read_unescaped("escaped", buffer, sizeof(buffer), value));
+		CHECK(value == expected_escaped);
+		CHECK(value.c_str() == buffer);
+
+		CHECK(parser.read_unescaped("empty", buffer, sizeof(buffer), value));
+		CHECK(value.empty());
+		CHECK(parser.eof());
+		CHECK(parser.is_valid());
+	}
+
+	{
+		Parser parser = parser_from_c_str(document);
+
+		char buffer[64];
+		StringView value;
+		CHECK(parser.read_unescaped("clean", buffer, 4, value));
+		CHECK(value == "no escapes");
+
+		const size_t expected_length = std::strlen(expected_escaped);
+		CHECK_FALSE(parser.read_unescaped("escaped", buffer, expected_length - 1, value));
+		CHECK(parser.get_error().error == ParserError::BufferTooSmall);
+	}
+
+	{
+		std::string mutable_document(document);
+		Parser parser(&mutable_document[0], mutable_document.size(), MutableInput());
+
+		StringView value;
+		CHECK(parser.read_unescaped_in_situ("clean", value));
+		CHECK(value == "no escapes");
+		CHECK(parser.read_unescaped_in_situ("escaped", value));
+		CHECK(value == expected_escaped);
+		CHECK(value.c_str() > mutable_document.c_str());
+		CHECK(value.c_str() < mutable_document.c_str() + mutable_document.size());
+		CHECK(parser.read_unescaped_in_situ("empty", value));
+		CHECK(value.empty());
+		CHECK(parser.eof());
+		CHECK(parser.is_valid());
+	}
+
+	{
+		Parser parser = parser_from_c_str("key = \"value\"");
+
+		StringView value;
+		CHECK_FALSE(parser.read_unescaped_in_situ("key", value));
+		CHECK(parser.get_error().error == ParserError::InputNotMutable);
+	}
+
+	{
+		// Without the tag, a mutable buffer is only read
+		std::string mutable_document("key = \"a\\tb\"");
+		Parser parser(&mutable_document[0], mutable_document.size());
+
+		StringView value;
+		CHECK_FALSE(parser.read_unescaped_in_situ("key", value));
+		CHECK(parser.get_error().error == ParserError::InputNotMutable);
+		CHECK(mutable_document == "key = \"a\\tb\"");
+	}
+}
+
+TEST_CASE("Parser UTF-8 Validation", "[parser]")
+{
+	{
+		// Disabled by default
+		Parser parser = parser_from_c_str("key = \"\xFF\"");
+		CHECK_FALSE(parser.is_utf8_validation_enabled());
+
+		StringView value;
+		CHECK(parser.read("key", value));
+		CHECK(parser.is_valid());
+	}
+
+	{
+		// Long ASCII runs, 2, 3, and 4 byte sequences, and escapes
+		Parser parser = parser_from_c_str("\"caf\xC3\xA9\" = \"this string is longer than sixteen bytes \xE2\x82\xAC \xF0\x9F\x98\x80 \\u00E9\" empty = \"\"");
+		parser.set_utf8_validation(true);
+		CHECK(parser.is_utf8_validation_enabled());
+
+		StringView value;
+		CHECK(parser.read("caf\xC3\xA9", value));
+		CHECK(value == "this string is longer than sixteen bytes \xE2\x82\xAC \xF0\x9F\x98\x80 \\u00E9");
+		CHECK(parser.read("empty", value));
+		CHECK(value.empty());
+		CHECK(parser.is_valid());
+	}
+
+	const char* invalid_strings[] =
+	{
+		"\x80",					// Lone continuation byte
+		"\xC0\xAF",				// Overlong 2 byte
+		"\xE0\x80\xAF",			// Overlong 3 byte
+		"\xF0\x80\x80\xAF",		// Overlong 4 byte
+		"\xED\xA0\x80",			// Surrogate
+		"\xF4\x90\x80\x80",		// Past U+10FFFF
+		"\xF5\x80\x80\x80",		// Invalid lead byte
+		"\xE2\x82",				// Truncated
+		"\xE2\x82" "a",			// Bad continuation byte
+	};
+
+	for (const char* invalid_string : invalid_strings)
+	{
+		char document[256];
+		std::snprintf(document, sizeof(document), "key = \"0123456789abcdefghij%s\"", invalid_string);
+
+		Parser parser = parser_from_c_str(document);
+		parser.set_utf8_validation(true);
+
+		StringView value;
+		CHECK_FALSE(parser.read("key", value));
+
+		const ParserError error = parser.get_error();
+		CHECK(error.error == ParserError::InvalidUtf8);
+		CHECK(error.line == 1);
+		CHECK(error.column == 28);
+	}
+
+	{
+		// Quoted keys are validated as well
+		Parser parser = parser_from_c_str("\"k\xFF\" = true");
+		parser.set_utf8_validation(true);
+
+		bool value;
+		CHECK_FALSE(parser.read("k", value));
+		CHECK(parser.get_error().error == ParserError::InvalidUtf8);
+	}
+
+	{
+		// Bytes that follow a backslash are validated as well
+		Parser parser = parser_from_c_str("key = \"a\\\xFF\"");
+		parser.set_utf8_validation(true);
+
+		StringView value;
+		CHECK_FALSE(parser.read("key", value));
+		CHECK(parser.get_error().error == ParserError::InvalidUtf8);
+		CHECK(parser.get_error().column == 10);
+	}
+}
+
+TEST_CASE("Parser Matrix Reading", "[parser]")
+{
+	{
+		Parser parser = parser_from_c_str("rotations = [ [ 0.0, 0.0, 0.0, 1.0 ], [ 0.5, -0.5, 0.5, -0.5 ] ] indices = [ [ 1, 2, 3 ], [ 4, 5, 6 ] ] empty = [ ]");
+
+		double rotations[2][4];
+		CHECK(parser.read_matrix("rotations", &rotations[0][0], 4, 2));
+		CHECK(rotations[0][0] == 0.0);
+		CHECK(rotations[0][3] == 1.0);
+		CHECK(rotations[1][0] == 0.5);
+		CHECK(rotations[1][1] == -0.5);
+		CHECK(rotations[1][3] == -0.5);
+
+		int32_t indices[6];
+		CHECK(parser.read_matrix("indices", indices, 3, 2));
+		for (int32_t i = 0; i < 6; ++i)
+			CHECK(indices[i] == i + 1);
+
+		float unused = 0.0F;
+		CHECK(parser.read_matrix("empty", &unused, 4, 0));
+		CHECK(parser.eof());
+		CHECK(parser.is_valid());
+	}
+
+	{
+		struct Transform
+		{
+			float rotation[4];
+			float translation[3];
+		};
+
+		Parser parser = parser_from_c_str("translations = [ [ 1.0, 2.0, 3.0 ], [ 4.0, 5.0, 6.0 ] ]");
+
+		Transform transforms[2] = {};
+		CHECK(parser.read_matrix("translations", &transforms[0].translation[0], 3, 2, sizeof(Transform)));
+		CHECK(transforms[0].translation[0] == 1.0F);
+		CHECK(transforms[0].translation[2] == 3.0F);
+		CHECK(transforms[1].translation[0] == 4.0F);
+		CHECK(transforms[1].translation[2] == 6.0F);
+		CHECK(transforms[1].rotation[3] == 0.0F);
+		CHECK(parser.is_valid());
+	}
+
+	{
+		// Rows that are too short or too long
+		Parser parser = parser_from_c_str("values = [ [ 1.0, 2.0 ], [ 3.0 ] ]");
+
+		double values[4];
+		CHECK_FALSE(parser.read_matrix("values", values, 2, 2));
+		CHECK(parser.get_error().error == ParserError::CommaExpected);
+	}
+
+	{
+		Parser parser = parser_from_c_str("values = [ [ 1, 2, 3 ] ]");
+
+		uint8_t values[2];
+		CHECK_FALSE(parser.read_matrix("values", values, 2, 1));
+		CHECK(parser.get_error().error == ParserError::ClosingBracketExpected);
+	}
+
+	{
+		Parser parser = parser_from_c_str("values = [ [ 1, 2 ], [ 3, 4 ] ]");
+
+		uint8_t values[2];
+		CHECK_FALSE(parser.read_matrix("values", values, 2, 1));
+		CHECK(parser.get_error().error == ParserError::ClosingBracketExpected);
+	}
+}
+
+TEST_CASE("Parser Half Float Reading", "[parser]")
+{
+	CHECK(sjson_impl::float_to_half(0.0F) == 0x0000);
+	CHECK(sjson_impl::float_to_half(-0.0F) == 0x8000);
+	CHECK(sjson_impl::float_to_half(1.0F) == 0x3C00);
+	CHECK(sjson_impl::float_to_half(-2.0F) == 0xC000);
+	CHECK(sjson_impl::float_to_half(65504.0F) == 0x7BFF);
+	CHECK(sjson_impl::float_to_half(65520.0F) == 0x7C00);
+	CHECK(sjson_impl::float_to_half(1.0e10F) == 0x7C00);
+	CHECK(sjson_impl::float_to_half(std::numeric_limits<float>::infinity()) == 0x7C00);
+	CHECK(sjson_impl::float_to_half(6.103515625e-05F) == 0x0400);		// Smallest normal
+	CHECK(sjson_impl::float_to_half(5.9604644775390625e-08F) == 0x0001);	// Smallest denormal
+	CHECK(sjson_impl::float_to_half(2.98023223876953125e-08F) == 0x0000);	// Ties to even
+	CHECK(sjson_impl::float_to_half(1.00048828125F) == 0x3C00);				// Ties to even
+	CHECK(sjson_impl::float_to_half(1.00146484375F) == 0x3C02);				// Ties to even
+	CHECK(sjson_impl::float_to_half(0.333333333F) == 0x3555);
+
+	// Enough values for several chunks and a partial one, to exercise both the SIMD and scalar paths
+	std::string document = "values = [ ";
+	const uint32_t num_values = 37;
+	for (uint32_t i = 0; i < num_values; ++i)
+	{
+		if (i != 0)
+			document += ", ";
+		document += std::to_string(float(i) * 0.25F - 4.0F);
+	}
+	document += " ] tail = [ 1.0, 2.0 ]";
+
+	Parser parser = parser_from_c_str(document.c_str());
+
+	uint16_t values[num_values];
+	CHECK(parser.read_half("values", values, num_values));
+	for (uint32_t i = 0; i < num_values; ++i)
+		CHECK(values[i] == sjson_impl::float_to_half(float(i) * 0.25F - 4.0F));
+
+	uint16_t tail[3];
+	CHECK_FALSE(parser.read_half("tail", tail, 3));
+	CHECK(parser.get_error().error == ParserError::CommaExpected);
+}
+
+TEST_CASE("Parser Normalized Reading", "[parser]")
+{
+	Parser parser = parser_from_c_str("snorm = [ -2.0, -1.0, -0.5, 0.0, 0.5, 1.0, 3.0 ] unorm = [ -1.0, 0.0, 0.5, 0.25, 1.0, 2.0 ] snorm8 = [ -1.0, 1.0 ] unorm16 = [ 0.5, 1.0 ]");
+
+	int16_t snorm[7];
+	CHECK(parser.read_normalized("snorm", snorm, 7));
+	CHECK(snorm[0] == -32767);
+	CHECK(snorm[1] == -32767);
+	CHECK(snorm[2] == -16384);
+	CHECK(snorm[3] == 0);
+	CHECK(snorm[4] == 16384);
+	CHECK(snorm[5] == 32767);
+	CHECK(snorm[6] == 32767);
+
+	uint8_t unorm[6];
+	CHECK(parser.read_normalized("unorm", unorm, 6));
+	CHECK(unorm[0] == 0);
+	CHECK(unorm[1] == 0);
+	CHECK(unorm[2] == 128);
+	CHECK(unorm[3] == 64);
+	CHECK(unorm[4] == 255);
+	CHECK(unorm[5] == 255);
+
+	int8_t snorm8[2];
+	CHECK(parser.read_normalized("snorm8", snorm8, 2));
+	CHECK(snorm8[0] == -127);
+	CHECK(snorm8[1] == 127);
+
+	uint16_t unorm16[2];
+	CHECK(parser.read_normalized("unorm16", unorm16, 2));
+	CHECK(unorm16[0] == 32768);
+	CHECK(unorm16[1] == 65535);
+
+	CHECK(parser.eof());
+	CHECK(parser.is_valid());
+}
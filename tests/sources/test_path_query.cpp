@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "catch2.impl.h"
+
+#include <sjson/parser.h>
+#include <sjson/path_query.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace sjson;
+
+namespace
+{
+	struct QueryMatch
+	{
+		uint32_t path_index;
+		std::string raw_value;
+	};
+
+	class RecordingHandler final : public QueryHandler
+	{
+	public:
+		virtual void on_match(uint32_t path_index, const StringView& raw_value) override
+		{
+			m_matches.push_back(QueryMatch{ path_index, std::string(raw_value.c_str(), raw_value.size()) });
+		}
+
+		const std::vector<QueryMatch>& get_matches() const { return m_matches; }
+
+	private:
+		std::vector<QueryMatch> m_matches;
+	};
+
+	const char* k_document =
+		"// Clip\r\n"
+		"clip = {\r\n"
+		"\tname = \"walk\"\r\n"
+		"\ttracks = [\r\n"
+		"\t\t{ name = \"root\" scale = 1.5 },\r\n"
+		"\t\t{ name = \"hips\" scale = [ 1, 2 ] }\r\n"
+		"\t]\r\n"
+		"}\r\n"
+		"settings = { sample_rate = 30 \"quoted key\" = true }\r\n";
+}
+
+TEST_CASE("Path Query Matching", "[query]")
+{
+	PathQuery query;
+	const uint32_t track_name_index = query.add_path("clip.tracks[*].name");
+	const uint32_t sample_rate_index = query.add_path("settings.sample_rate");
+	const uint32_t second_track_index = query.add_path("clip.tracks[1]");
+	const uint32_t scale_index = query.add_path("clip.tracks[1].scale[1]");
+	const uint32_t any_key_index = query.add_path("settings.*");
+	const uint32_t missing_index = query.add_path("clip.tracks[2].name");
+	CHECK(query.get_num_paths() == 6);
+
+	RecordingHandler handler;
+	Parser parser(k_document, std::strlen(k_document));
+	CHECK(query.run(parser, handler));
+
+	const std::vector<QueryMatch>& matches = handler.get_matches();
+	REQUIRE(matches.size() == 7);
+	CHECK(matches[0].path_index == track_name_index);
+	CHECK(matches[0].raw_value == "\"root\"");
+	CHECK(matches[1].path_index == track_name_index);
+	CHECK(matches[1].raw_value == "\"hips\"");
+	CHECK(matches[2].path_index == scale_index);
+	CHECK(matches[2].raw_value == "2");
+	CHECK(matches[3].path_index == second_track_index);
+	CHECK(matches[3].raw_value == "{ name = \"hips\" scale = [ 1, 2 ] }");
+	CHECK(matches[4].path_index == sample_rate_index);
+	CHECK(matches[4].raw_value == "30");
+	CHECK(matches[5].path_index == any_key_index);
+	CHECK(matches[5].raw_value == "30");
+	CHECK(matches[6].path_index == any_key_index);
+	CHECK(matches[6].raw_value == "true");
+
+	for (const QueryMatch& match : matches)
+		CHECK(match.path_index != missing_index);
+
+	// A compiled query can be run again on other inputs
+	const char* document = "settings = { sample_rate = 48 }";
+	RecordingHandler other_handler;
+	Parser other_parser(document, std::strlen(document));
+	CHECK(query.run(other_parser, other_handler));
+	REQUIRE(other_handler.get_matches().size() == 2);
+	CHECK(other_handler.get_matches()[0].raw_value == "48");
+}
+
+TEST_CASE("Path Query Invalid Input", "[query]")
+{
+	PathQuery query;
+	query.add_path("clip.unknown");
+
+	{
+		const char* document = "clip = { tracks = [ 1, 2 }";
+		RecordingHandler handler;
+		Parser parser(document, std::strlen(document));
+		CHECK_FALSE(query.run(parser, handler));
+		CHECK(parser.get_error().error == ParserError::CommaExpected);
+	}
+
+	{
+		const char* document = "clip = { name = \"walk";
+		RecordingHandler handler;
+		Parser parser(document, std::strlen(document));
+		CHECK_FALSE(query.run(parser, handler));
+		CHECK(parser.get_error().error == ParserError::InputTruncated);
+	}
+
+	PathQuery invalid_query;
+	const uint32_t invalid_path_index = PathQuery::k_invalid_path_index;
+	CHECK(invalid_query.add_path("clip.tracks[x]") == invalid_path_index);
+	CHECK(invalid_query.add_path("clip.tracks[1") == invalid_path_index);
+	CHECK(invalid_query.add_path("clip.tracks[99999999999999999999999]") == invalid_path_index);
+	CHECK(invalid_query.add_path("clip..name") == invalid_path_index);
+	CHECK(invalid_query.add_path("clip.") == invalid_path_index);
+	CHECK(invalid_query.add_path("") == invalid_path_index);
+	CHECK(invalid_query.get_num_paths() == 0);
+	CHECK(invalid_query.add_path("clip.name") == 0);
+}
@@ -0,0 +1,237 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "catch2.impl.h"
+
+#include <sjson/parser.h>
+#include <sjson/record_splitter.h>
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace sjson;
+
+namespace
+{
+	// Sums the value of every record, the index is checked against the value
+	class SummingHandler final : public RecordHandler
+	{
+	public:
+		virtual bool on_record(size_t record_index, Parser& parser) override
+		{
+			uint32_t value;
+			StringView name;
+			if (!parser.read("value", value) || !parser.read("name", name) || !parser.remainder_is_comments_and_whitespace())
+				return false;
+
+			if (value != record_index)
+				m_num_mismatches++;
+
+			m_sum += value;
+			m_num_records++;
+			return true;
+		}
+
+		std::atomic<uint64_t> m_sum{ 0 };
+		std::atomic<uint32_t> m_num_records{ 0 };
+		std::atomic<uint32_t> m_num_mismatches{ 0 };
+	};
+
+	std::string make_records(uint32_t num_records)
+	{
+		std::string input;
+		for (uint32_t i = 0; i < num_records; ++i)
+		{
+			input += "{ value = " + std::to_string(i) + " name = \"record {" + std::to_string(i) + "} \\\" /* not a comment\" }";
+			input += (i % 3) == 0 ? " // }\n" : ((i % 3) == 1 ? "\r\n" : " /* { */ ");
+		}
+
+		return input;
+	}
+
+	// Reads the records on the calling thread and on num_threads - 1 other threads
+	struct ThreadExecutor
+	{
+		uint32_t num_threads;
+
+		template<typename TaskFunType>
+		void operator()(TaskFunType task) const
+		{
+			std::vector<std::thread> workers;
+			for (uint32_t thread_index = 1; thread_index < num_threads; ++thread_index)
+				workers.emplace_back(task);
+
+			task();
+
+			for (std::thread& worker : workers)
+				worker.join();
+		}
+	};
+}
+
+TEST_CASE("Record Splitting", "[records]")
+{
+	{
+		const char* input = "\xEF\xBB\xBF// Log\n{ a = 1 }{ b = { c = \"}\" } }\n\n/* } */ { }  { d = [ { e = 2 } ] // }\n }";
+		RecordSplitter splitter(input, std::strlen(input));
+
+		StringView record;
+		CHECK(splitter.next_record(record));
+		CHECK(record == "{ a = 1 }");
+		CHECK(splitter.next_record(record));
+		CHECK(record == "{ b = { c = \"}\" } }");
+		CHECK(splitter.next_record(record));
+		CHECK(record == "{ }");
+		CHECK(splitter.next_record(record));
+		CHECK(record == "{ d = [ { e = 2 } ] // }\n }");
+		CHECK_FALSE(splitter.next_record(record));
+		CHECK(splitter.eof());
+		CHECK(splitter.is_valid());
+	}
+
+	{
+		const char* input = "{ a = 1 }\n{ b = \"unterminated }";
+		RecordSplitter splitter(input, std::strlen(input));
+
+		StringView record;
+		CHECK(splitter.next_record(record));
+		CHECK_FALSE(splitter.next_record(record));
+		CHECK_FALSE(splitter.is_valid());
+		CHECK(splitter.get_error().error == ParserError::InputTruncated);
+		CHECK(splitter.get_error().line == 2);
+		CHECK(splitter.get_error().column == 2);
+	}
+
+	{
+		const char* input = "{ a = 1 } b = 2";
+		RecordSplitter splitter(input, std::strlen(input));
+
+		StringView record;
+		CHECK(splitter.next_record(record));
+		CHECK_FALSE(splitter.next_record(record));
+		CHECK(splitter.get_error().error == ParserError::OpeningBraceExpected);
+		CHECK(splitter.get_error().column == 11);
+	}
+
+	{
+		// Records are separated by the same whitespace as the Parser accepts
+		const char* input = "{ a = 1 }\f\v{ b = 2 }";
+		RecordSplitter splitter(input, std::strlen(input));
+
+		StringView record;
+		CHECK(splitter.next_record(record));
+		CHECK(splitter.next_record(record));
+		CHECK(record == "{ b = 2 }");
+		CHECK(splitter.eof());
+		CHECK(splitter.is_valid());
+	}
+
+	{
+		// The error position of the last symbol of the input
+		const char* input = "{ a = 1 }\n/";
+		RecordSplitter splitter(input, std::strlen(input));
+
+		StringView record;
+		CHECK(splitter.next_record(record));
+		CHECK_FALSE(splitter.next_record(record));
+		CHECK(splitter.get_error().error == ParserError::CommentBeginsIncorrectly);
+		CHECK(splitter.get_error().line == 2);
+		CHECK(splitter.get_error().column == 2);
+	}
+
+	{
+		const char* input = "{ a = 1 } /* unterminated";
+		RecordSplitter splitter(input, std::strlen(input));
+
+		StringView record;
+		CHECK(splitter.next_record(record));
+		CHECK_FALSE(splitter.next_record(record));
+		CHECK(splitter.get_error().error == ParserError::InputTruncated);
+	}
+}
+
+TEST_CASE("Record Reading", "[records]")
+{
+	const uint32_t num_records = 1000;
+	const std::string input = make_records(num_records);
+	const uint64_t expected_sum = uint64_t(num_records) * (num_records - 1) / 2;
+
+	{
+		SummingHandler handler;
+		RecordError error;
+		CHECK(for_each_record(input.c_str(), input.size(), handler, error));
+		CHECK(error.error.error == ParserError::None);
+		CHECK(handler.m_num_records == num_records);
+		CHECK(handler.m_num_mismatches == 0);
+		CHECK(handler.m_sum == expected_sum);
+	}
+
+	for (uint32_t num_threads = 1; num_threads <= 4; ++num_threads)
+	{
+		SummingHandler handler;
+		RecordError error;
+		CHECK(parallel_for_each_record(input.c_str(), input.size(), handler, ThreadExecutor{ num_threads }, error));
+		CHECK(error.error.error == ParserError::None);
+		CHECK(handler.m_num_records == num_records);
+		CHECK(handler.m_num_mismatches == 0);
+		CHECK(handler.m_sum == expected_sum);
+	}
+
+	{
+		// The record at index 2 is missing its name
+		const char* invalid_input = "{ value = 0 name = \"a\" } { value = 1 name = \"b\" } { value = 2 } { value = 3 name = \"d\" }";
+
+		const size_t invalid_record_offset = std::strstr(invalid_input, "{ value = 2 }") - invalid_input;
+
+		SummingHandler handler;
+		RecordError error;
+		CHECK_FALSE(for_each_record(invalid_input, std::strlen(invalid_input), handler, error));
+		CHECK(error.error.error == ParserError::InputTruncated);
+		CHECK(error.record_index == 2);
+		CHECK(error.record_offset == invalid_record_offset);
+		CHECK(handler.m_num_records == 2);
+
+		SummingHandler parallel_handler;
+		RecordError parallel_error;
+		CHECK_FALSE(parallel_for_each_record(invalid_input, std::strlen(invalid_input), parallel_handler, ThreadExecutor{ 4 }, parallel_error));
+		CHECK(parallel_error.error.error == ParserError::InputTruncated);
+		CHECK(parallel_error.record_index == 2);
+		CHECK(parallel_error.record_offset == invalid_record_offset);
+	}
+
+	{
+		const std::string truncated_input = input + "{ value = 1000";
+
+		SummingHandler handler;
+		RecordError error;
+		CHECK_FALSE(parallel_for_each_record(truncated_input.c_str(), truncated_input.size(), handler, ThreadExecutor{ 3 }, error));
+		CHECK(error.error.error == ParserError::InputTruncated);
+		CHECK(error.record_index == num_records);
+		CHECK(error.record_offset == input.size());
+		CHECK(handler.m_num_records == num_records);
+	}
+}
@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "catch2.impl.h"
+#include "test_helpers.h"
+
+#include <sjson/parser.h>
+#include <sjson/schema.h>
+#include <sjson/writer.h>
+
+#include <cstring>
+#include <string>
+
+using namespace sjson;
+
+namespace
+{
+	struct Clip
+	{
+		StringView name;
+		uint32_t sample_rate;
+		float duration;
+		double error_threshold;
+		bool is_looping;
+		int8_t priority;
+	};
+
+	struct Marker
+	{
+		uint64_t frame;
+		int64_t offset;
+	};
+
+	const auto k_marker_schema = make_schema(
+		schema_field("frame", &Marker::frame),
+		schema_field("time offset", &Marker::offset));
+
+	const auto k_clip_schema = make_schema(
+		schema_field("name", &Clip::name),
+		schema_field("sample_rate", &Clip::sample_rate, 30),
+		schema_field("duration", &Clip::duration, 0.0F),
+		schema_field("error_threshold", &Clip::error_threshold, 0.01),
+		schema_field("is_looping", &Clip::is_looping, false),
+		schema_field("priority", &Clip::priority, -1));
+}
+
+TEST_CASE("Schema Reading", "[schema]")
+{
+	{
+		// Keys can be in any order and unknown keys are skipped
+		Parser parser = parser_from_c_str(
+			"clip = {\n"
+			"\tis_looping = true\n"
+			"\tunknown = { values = [ 1, 2 ] }\n"
+			"\tduration = 1.5\n"
+			"\t\"name\" = \"walk\"\n"
+			"\tsample_rate = 60\n"
+			"\terror_threshold = null\n"
+			"\tpriority = -3\n"
+			"}");
+
+		Clip clip;
+		CHECK(k_clip_schema.read(parser, "clip", clip));
+		CHECK(clip.name == "walk");
+		CHECK(clip.sample_rate == 60);
+		CHECK(clip.duration == 1.5F);
+		CHECK(clip.error_threshold == 0.01);
+		CHECK(clip.is_looping == true);
+		CHECK(clip.priority == -3);
+		CHECK(parser.eof());
+		CHECK(parser.is_valid());
+	}
+
+	{
+		// Missing optional members receive their default value
+		Parser parser = parser_from_c_str("name = \"run\" duration = 2.0");
+
+		Clip clip;
+		clip.sample_rate = 0;
+		CHECK(k_clip_schema.read_root(parser, clip));
+		CHECK(clip.name == "run");
+		CHECK(clip.sample_rate == 30);
+		CHECK(clip.duration == 2.0F);
+		CHECK(clip.error_threshold == 0.01);
+		CHECK(clip.is_looping == false);
+		CHECK(clip.priority == -1);
+	}
+}
+
+TEST_CASE("Schema Reading Errors", "[schema]")
+{
+	{
+		Parser parser = parser_from_c_str("clip = { sample_rate = 60 }");
+
+		Clip clip;
+		CHECK_FALSE(k_clip_schema.read(parser, "clip", clip));
+		CHECK(parser.get_error().error == ParserError::RequiredKeyMissing);
+	}
+
+	{
+		Parser parser = parser_from_c_str("clip = { name = \"walk\" sample_rate = -60 }");
+
+		Clip clip;
+		CHECK_FALSE(k_clip_schema.read(parser, "clip", clip));
+		CHECK(parser.get_error().error == ParserError::NumberCouldNotBeConverted);
+	}
+
+	{
+		Parser parser = parser_from_c_str("clip = { name = \"walk\" priority = 1000 }");
+
+		Clip clip;
+		CHECK_FALSE(k_clip_schema.read(parser, "clip", clip));
+		CHECK(parser.get_error().error == ParserError::NumberCouldNotBeConverted);
+	}
+
+	{
+		Parser parser = parser_from_c_str("other = { name = \"walk\" }");
+
+		Clip clip;
+		CHECK_FALSE(k_clip_schema.read(parser, "clip", clip));
+		CHECK(parser.get_error().error == ParserError::IncorrectKey);
+	}
+
+	// Two fields cannot use the same key
+	CHECK_THROWS(make_schema(schema_field("frame", &Marker::frame), schema_field("frame", &Marker::offset)));
+}
+
+TEST_CASE("Schema Hash Collisions", "[schema]")
+{
+	// Both keys have the same hash, no perfect hash table exists and every key is compared instead
+	CHECK(sjson_impl::hash_key_runtime("costarring", 10) == sjson_impl::hash_key_runtime("liquid", 6));
+
+	const auto colliding_schema = make_schema(
+		schema_field("costarring", &Marker::frame),
+		schema_field("liquid", &Marker::offset, 0));
+
+	{
+		Parser parser = parser_from_c_str("liquid = -5 costarring = 12");
+
+		Marker marker;
+		CHECK(colliding_schema.read_root(parser, marker));
+		CHECK(marker.frame == 12);
+		CHECK(marker.offset == -5);
+	}
+
+	{
+		Parser parser = parser_from_c_str("costarring = 12 unknown = 3");
+
+		Marker marker;
+		marker.offset = 7;
+		CHECK(colliding_schema.read_root(parser, marker));
+		CHECK(marker.frame == 12);
+		CHECK(marker.offset == 0);
+	}
+}
+
+TEST_CASE("Schema Writing", "[schema]")
+{
+	Clip clip;
+	clip.name = "walk \"fast\"";
+	clip.sample_rate = 60;
+	clip.duration = 1.5F;
+	clip.error_threshold = 0.25;
+	clip.is_looping = true;
+	clip.priority = -3;
+
+	{
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		k_clip_schema.write(writer, "clip", clip);
+
+		StringStreamWriter expected_str_writer;
+		Writer expected_writer(expected_str_writer);
+		expected_writer["clip"] = [&](ObjectWriter& object_writer)
+		{
+			object_writer["name"] = clip.name;
+			object_writer["sample_rate"] = clip.sample_rate;
+			object_writer["duration"] = clip.duration;
+			object_writer["error_threshold"] = clip.error_threshold;
+			object_writer["is_looping"] = clip.is_looping;
+			object_writer["priority"] = clip.priority;
+		};
+
+		CHECK(str_writer.str() == expected_str_writer.str());
+
+		Clip read_clip;
+		Parser parser(str_writer.str().c_str(), str_writer.str().size());
+		CHECK(k_clip_schema.read(parser, "clip", read_clip));
+		CHECK(read_clip.name == "walk \\\"fast\\\"");	// Strings are read raw
+		CHECK(read_clip.sample_rate == clip.sample_rate);
+		CHECK(read_clip.duration == clip.duration);
+		CHECK(read_clip.error_threshold == clip.error_threshold);
+		CHECK(read_clip.is_looping == clip.is_looping);
+		CHECK(read_clip.priority == clip.priority);
+	}
+
+	{
+		Marker marker;
+		marker.frame = UINT64_MAX;
+		marker.offset = INT64_MIN;
+
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		k_marker_schema.write_members(writer, marker);
+		CHECK(str_writer.str() == "frame = 18446744073709551615\r\n\"time offset\" = -9223372036854775808\r\n");
+	}
+
+	{
+		// Past the precomputed indentation, members are written the regular way
+		Marker marker;
+		marker.frame = 12;
+		marker.offset = -4;
+
+		std::function<void(ObjectWriter&, uint32_t)> write_nested = [&](ObjectWriter& object_writer, uint32_t depth)
+		{
+			if (depth == 0)
+				k_marker_schema.write_members(object_writer, marker);
+			else
+				object_writer["nested"] = [&](ObjectWriter& nested_writer) { write_nested(nested_writer, depth - 1); };
+		};
+
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		write_nested(writer, 10);
+
+		std::string expected_members;
+		for (uint32_t level = 0; level < 10; ++level)
+			expected_members += "\t";
+		expected_members = expected_members + "frame = 12\r\n" + expected_members + "\"time offset\" = -4\r\n";
+		CHECK(str_writer.str().find(expected_members) != std::string::npos);
+	}
+}
@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette, Cody Jones, and sjson-cpp contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "catch2.impl.h"
+#include "test_helpers.h"
+
+#include <sjson/parser.h>
+#include <sjson/stream_transform.h>
+#include <sjson/writer.h>
+
+#include <cstring>
+#include <string>
+
+using namespace sjson;
+
+namespace
+{
+	struct DropHandler final : public TransformHandler
+	{
+		virtual void transform(TransformContext& context) override { context.drop(); }
+	};
+
+	struct RenameHandler final : public TransformHandler
+	{
+		virtual void transform(TransformContext& context) override { context.rename("frame_rate"); }
+	};
+
+	struct ScaleHandler final : public TransformHandler
+	{
+		uint32_t num_calls = 0;
+
+		virtual void transform(TransformContext& context) override
+		{
+			const StringView raw_value = context.get_raw_value();
+			Parser parser(raw_value.c_str(), raw_value.size());
+
+			double value = 0.0;
+			if (parser.read(&value, 1))
+				context.replace(value * 2.0);
+
+			num_calls++;
+		}
+	};
+
+	struct ObjectHandler final : public TransformHandler
+	{
+		virtual void transform(TransformContext& context) override
+		{
+			context.replace([](ObjectWriter& writer) { writer["value"] = 1; });
+		}
+	};
+
+	const char* k_document =
+		"// Clip\r\n"
+		"clip = {\r\n"
+		"\tname = \"walk\"   // Inline comment\r\n"
+		"\trate = 30\r\n"
+		"\ttracks = [\r\n"
+		"\t\t{ name = \"root\" scale = 1.5 },\r\n"
+		"\t\t{ name = \"hips\" scale = 0x1p-1 }\r\n"
+		"\t]\r\n"
+		"\tsamples = [ 1, 2, 3 ]\r\n"
+		"}\r\n"
+		"/* Trailing comment */\r\n";
+}
+
+TEST_CASE("Stream Transform Passthrough", "[transform]")
+{
+	StringStreamWriter str_writer;
+	Parser parser(k_document, std::strlen(k_document));
+	StreamTransform transform(parser, str_writer);
+	CHECK(transform.run());
+	CHECK(str_writer.str() == k_document);
+
+	DropHandler drop_handler;
+	StringStreamWriter unmatched_writer;
+	Parser unmatched_parser(k_document, std::strlen(k_document));
+	StreamTransform unmatched_transform(unmatched_parser, unmatched_writer);
+	CHECK(unmatched_transform.add_handler("clip.tracks[*].unknown", drop_handler));
+	CHECK(unmatched_transform.add_handler("clip.samples[5]", drop_handler));
+
+	// Malformed paths are rejected and nothing is dropped
+	CHECK_FALSE(unmatched_transform.add_handler("clip..rate", drop_handler));
+	CHECK_FALSE(unmatched_transform.add_handler("clip.samples[x]", drop_handler));
+	CHECK_FALSE(unmatched_transform.add_handler("", drop_handler));
+	CHECK(unmatched_transform.run());
+	CHECK(unmatched_writer.str() == k_document);
+}
+
+TEST_CASE("Stream Transform Replace Rename", "[transform]")
+{
+	ScaleHandler scale_handler;
+	RenameHandler rename_handler;
+
+	StringStreamWriter str_writer;
+	Parser parser(k_document, std::strlen(k_document));
+	StreamTransform transform(parser, str_writer);
+	transform.add_handler("clip.tracks[*].scale", scale_handler);
+	transform.add_handler("clip.samples[1]", scale_handler);
+	transform.add_handler("clip.rate", rename_handler);
+	CHECK(transform.run());
+	CHECK(scale_handler.num_calls == 3);
+
+	const std::string expected =
+		"// Clip\r\n"
+		"clip = {\r\n"
+		"\tname = \"walk\"   // Inline comment\r\n"
+		"\tframe_rate = 30\r\n"
+		"\ttracks = [\r\n"
+		"\t\t{ name = \"root\" scale = 3 },\r\n"
+		"\t\t{ name = \"hips\" scale = 1 }\r\n"
+		"\t]\r\n"
+		"\tsamples = [ 1, 4, 3 ]\r\n"
+		"}\r\n"
+		"/* Trailing comment */\r\n";
+	CHECK(str_writer.str() == expected);
+}
+
+TEST_CASE("Stream Transform Replace Object", "[transform]")
+{
+	ObjectHandler object_handler;
+
+	StringStreamWriter str_writer;
+	Parser parser(k_document, std::strlen(k_document));
+	StreamTransform transform(parser, str_writer);
+	transform.add_handler("clip.rate", object_handler);
+	transform.add_handler("clip.samples[2]", object_handler);
+	CHECK(transform.run());
+
+	const std::string expected =
+		"// Clip\r\n"
+		"clip = {\r\n"
+		"\tname = \"walk\"   // Inline comment\r\n"
+		"\trate = {\r\n"
+		"\t\tvalue = 1\r\n"
+		"\t}\r\n"
+		"\ttracks = [\r\n"
+		"\t\t{ name = \"root\" scale = 1.5 },\r\n"
+		"\t\t{ name = \"hips\" scale = 0x1p-1 }\r\n"
+		"\t]\r\n"
+		"\tsamples = [ 1, 2, {\r\n"
+		"\t\tvalue = 1\r\n"
+		"\t} ]\r\n"
+		"}\r\n"
+		"/* Trailing comment */\r\n";
+	CHECK(str_writer.str() == expected);
+}
+
+TEST_CASE("Stream Transform Drop", "[transform]")
+{
+	DropHandler drop_handler;
+
+	{
+		StringStreamWriter str_writer;
+		Parser parser(k_document, std::strlen(k_document));
+		StreamTransform transform(parser, str_writer);
+		transform.add_handler("clip.rate", drop_handler);
+		transform.add_handler("clip.name", drop_handler);
+		transform.add_handler("clip.tracks[0]", drop_handler);
+		transform.add_handler("clip.samples[*]", drop_handler);
+		CHECK(transform.run());
+
+		const std::string expected =
+			"// Clip\r\n"
+			"clip = {\r\n"
+			"\ttracks = [\r\n"
+			"\t\t{ name = \"hips\" scale = 0x1p-1 }\r\n"
+			"\t]\r\n"
+			"\tsamples = [  ]\r\n"
+			"}\r\n"
+			"/* Trailing comment */\r\n";
+		CHECK(str_writer.str() == expected);
+	}
+
+	{
+		StringStreamWriter str_writer;
+		Parser parser(k_document, std::strlen(k_document));
+		StreamTransform transform(parser, str_writer);
+		transform.add_handler("clip.samples[1]", drop_handler);
+		transform.add_handler("clip.samples[2]", drop_handler);
+		transform.add_handler("clip.tracks[1]", drop_handler);
+		CHECK(transform.run());
+
+		const std::string expected =
+			"// Clip\r\n"
+			"clip = {\r\n"
+			"\tname = \"walk\"   // Inline comment\r\n"
+			"\trate = 30\r\n"
+			"\ttracks = [\r\n"
+			"\t\t{ name = \"root\" scale = 1.5 }\r\n"
+			"\t]\r\n"
+			"\tsamples = [ 1 ]\r\n"
+			"}\r\n"
+			"/* Trailing comment */\r\n";
+		CHECK(str_writer.str() == expected);
+	}
+}
+
+TEST_CASE("Stream Transform Invalid Input", "[transform]")
+{
+	const char* document = "clip = { tracks = [ 1, 2 }";
+
+	StringStreamWriter str_writer;
+	Parser parser(document, std::strlen(document));
+	StreamTransform transform(parser, str_writer);
+	CHECK_FALSE(transform.run());
+	CHECK(parser.get_error().error == ParserError::CommaExpected);
+
+	const char* invalid_numbers[] = { "clip = -", "clip = 1-2-3", "clip = { rate = 30.0.1 }" };
+	for (size_t i = 0; i < 3; ++i)
+	{
+		StringStreamWriter number_writer;
+		Parser number_parser(invalid_numbers[i], std::strlen(invalid_numbers[i]));
+		StreamTransform number_transform(number_parser, number_writer);
+		CHECK_FALSE(number_transform.run());
+		CHECK_FALSE(number_parser.is_valid());
+	}
+}
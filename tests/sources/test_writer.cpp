@@ -23,33 +23,15 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "catch2.impl.h"
+#include "test_helpers.h"
 
+#include <sjson/parser.h>
 #include <sjson/writer.h>
-#include <sjson/impl/bit_cast.impl.h>
 
-#include <sstream>
 #include <string>
 
 using namespace sjson;
 
-class StringStreamWriter final : public StreamWriter
-{
-public:
-	StringStreamWriter() = default;
-	StringStreamWriter(const StringStreamWriter&) = delete;
-	StringStreamWriter& operator=(const StringStreamWriter&) = delete;
-
-	virtual void write(const void* buffer, size_t buffer_size) override
-	{
-		m_buffer.sputn(sjson_impl::bit_cast<const char*>(buffer), static_cast<std::streamsize>(buffer_size));
-	}
-
-	std::string str() const { return m_buffer.str(); }
-
-private:
-	std::stringbuf m_buffer;
-};
-
 TEST_CASE("Writer Object Bool Writing", "[writer]")
 {
 	{
@@ -101,47 +83,109 @@ TEST_CASE("Writer Object String Writing", "[writer]")
 		StringStreamWriter str_writer;
 		Writer writer(str_writer);
 		writer.insert("key", "some\tstring");
-		CHECK(str_writer.str() == "key = \"some\tstring\"\r\n");
+		CHECK(str_writer.str() == "key = \"some\\tstring\"\r\n");
 	}
 
 	{
 		StringStreamWriter str_writer;
 		Writer writer(str_writer);
 		writer["key"] = "some\tstring";
-		CHECK(str_writer.str() == "key = \"some\tstring\"\r\n");
+		CHECK(str_writer.str() == "key = \"some\\tstring\"\r\n");
 	}
 
 	{
 		StringStreamWriter str_writer;
 		Writer writer(str_writer);
 		writer.insert("key", "some\nstring");
-		CHECK(str_writer.str() == "key = \"some\nstring\"\r\n");
+		CHECK(str_writer.str() == "key = \"some\\nstring\"\r\n");
 	}
 
 	{
 		StringStreamWriter str_writer;
 		Writer writer(str_writer);
 		writer["key"] = "some\nstring";
-		CHECK(str_writer.str() == "key = \"some\nstring\"\r\n");
+		CHECK(str_writer.str() == "key = \"some\\nstring\"\r\n");
 	}
 
 	{
 		StringStreamWriter str_writer;
 		Writer writer(str_writer);
 		writer.insert("key", "some\"string");
-		CHECK(str_writer.str() == "key = \"some\"string\"\r\n");
+		CHECK(str_writer.str() == "key = \"some\\\"string\"\r\n");
 	}
 
 	{
 		StringStreamWriter str_writer;
 		Writer writer(str_writer);
 		writer["key"] = "some\"string";
-		CHECK(str_writer.str() == "key = \"some\"string\"\r\n");
+		CHECK(str_writer.str() == "key = \"some\\\"string\"\r\n");
+	}
+}
+
+TEST_CASE("Writer String Escaping", "[writer]")
+{
+	{
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer.insert("key", "back\\slash \b\f\r \x01\x1F end");
+		CHECK(str_writer.str() == "key = \"back\\\\slash \\b\\f\\r \\u0001\\u001f end\"\r\n");
+	}
+
+	{
+		// Long enough to exercise the SIMD path, with escapes on both sides of a 16 byte boundary
+		const std::string value = std::string(15, 'a') + "\"" + std::string(20, 'b') + "\\" + std::string(3, 'c');
+		const std::string expected = "key = \"" + std::string(15, 'a') + "\\\"" + std::string(20, 'b') + "\\\\" + std::string(3, 'c') + "\"\r\n";
+
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer.insert("key", StringView(value.c_str(), value.size()));
+		CHECK(str_writer.str() == expected);
+	}
+
+	{
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer["key"] = StringView("some string", 4);
+		writer.insert("array", [](ArrayWriter& array_writer)
+		{
+			array_writer.push(StringView("quote\"", 6));
+		});
+		CHECK(str_writer.str() == "key = \"some\"\r\narray = [ \"quote\\\"\" ]\r\n");
+	}
+
+	{
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer.insert("some key", true);
+		writer.insert("a=b", true);
+		writer.insert("\"quoted\"", true);
+		writer.insert("//comment", true);
+		writer.insert("", true);
+		writer.insert("key-one", true);
+		CHECK(str_writer.str() == "\"some key\" = true\r\n\"a=b\" = true\r\n\"\\\"quoted\\\"\" = true\r\n\"//comment\" = true\r\n\"\" = true\r\nkey-one = true\r\n");
 	}
 }
 
 TEST_CASE("Writer Object Number Writing", "[writer]")
 {
+	{
+		// The shortest decimal form that round-trips is only written on request
+		StringStreamWriter str_writer;
+		Writer writer(str_writer, FloatFormat::ShortestDecimal);
+		writer["key0"] = 0.1;
+		writer["key1"] = 0.1 + 0.2;
+		writer["key2"] = 1.0 / 3.0;
+		writer["key3"] = 5.0e-324;
+		writer["key4"] = 0.0;
+		CHECK(str_writer.str() == "key0 = 0.1\r\nkey1 = 0.30000000000000004\r\nkey2 = 0.3333333333333333\r\nkey3 = 5e-324\r\nkey4 = 0\r\n");
+
+		StringStreamWriter decimal_writer;
+		Writer default_writer(decimal_writer);
+		default_writer["key0"] = 0.1;
+		default_writer["key1"] = 12.5;
+		CHECK(decimal_writer.str() == "key0 = 0.10000000000000001\r\nkey1 = 12.5\r\n");
+	}
+
 	{
 		StringStreamWriter str_writer;
 		Writer writer(str_writer);
@@ -521,7 +565,7 @@ TEST_CASE("Writer Array String Writing", "[writer]")
 		{
 			array_writer.push("some\tstring");
 		});
-		CHECK(str_writer.str() == "key = [ \"some\tstring\" ]\r\n");
+		CHECK(str_writer.str() == "key = [ \"some\\tstring\" ]\r\n");
 	}
 
 	{
@@ -531,7 +575,7 @@ TEST_CASE("Writer Array String Writing", "[writer]")
 		{
 			array_writer.push("some\nstring");
 		});
-		CHECK(str_writer.str() == "key = [ \"some\nstring\" ]\r\n");
+		CHECK(str_writer.str() == "key = [ \"some\\nstring\" ]\r\n");
 	}
 
 	{
@@ -541,7 +585,7 @@ TEST_CASE("Writer Array String Writing", "[writer]")
 		{
 			array_writer.push("some\"string");
 		});
-		CHECK(str_writer.str() == "key = [ \"some\"string\" ]\r\n");
+		CHECK(str_writer.str() == "key = [ \"some\\\"string\" ]\r\n");
 	}
 }
 
@@ -757,3 +801,268 @@ TEST_CASE("Writer Array Object Writing", "[writer]")
 		CHECK(str_writer.str() == "key = [ \r\n\t{\r\n\t\tkey0 = 123.5\r\n\t\tkey1 = 456.5\r\n\t}\r\n]\r\n");
 	}
 }
+
+TEST_CASE("Writer Object Fragment Writing", "[writer]")
+{
+	const auto write_track = [](ObjectWriter& object_writer, uint32_t track_index)
+	{
+		object_writer.insert("index", track_index);
+		object_writer.insert("name", "track");
+		object_writer.insert("values", [](ArrayWriter& array_writer)
+		{
+			array_writer.push(1.5);
+			array_writer.push(2.5);
+		});
+		object_writer.insert("settings", [](ObjectWriter& object_writer1)
+		{
+			object_writer1.insert("enabled", true);
+		});
+	};
+
+	{
+		StringStreamWriter serial_str_writer;
+		Writer serial_writer(serial_str_writer);
+		serial_writer.insert("tracks", [&](ArrayWriter& array_writer)
+		{
+			for (uint32_t track_index = 0; track_index < 3; ++track_index)
+				array_writer.push([&](ObjectWriter& object_writer) { write_track(object_writer, track_index); });
+		});
+		serial_writer.insert("root", [&](ObjectWriter& object_writer) { write_track(object_writer, 3); });
+
+		// Fragments are written independently first and spliced afterwards
+		StringStreamWriter fragment_str_writers[4];
+
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer.insert("tracks", [&](ArrayWriter& array_writer)
+		{
+			for (uint32_t track_index = 0; track_index < 3; ++track_index)
+			{
+				ObjectFragmentWriter fragment_writer(fragment_str_writers[track_index], array_writer.get_fragment_indent_level());
+				write_track(fragment_writer, track_index);
+			}
+
+			for (uint32_t track_index = 0; track_index < 3; ++track_index)
+			{
+				const std::string fragment = fragment_str_writers[track_index].str();
+				array_writer.push_fragment(fragment.c_str(), fragment.size());
+			}
+		});
+
+		{
+			ObjectFragmentWriter fragment_writer(fragment_str_writers[3], writer.get_fragment_indent_level());
+			write_track(fragment_writer, 3);
+		}
+
+		const std::string fragment = fragment_str_writers[3].str();
+		writer.insert_fragment("root", fragment.c_str(), fragment.size());
+
+		CHECK(str_writer.str() == serial_str_writer.str());
+	}
+
+	{
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer.insert("key", [](ArrayWriter& array_writer)
+		{
+			array_writer.push(1.5);
+			array_writer.push_fragment("", 0);
+		});
+		CHECK(str_writer.str() == "key = [ 1.5,\r\n\t{\r\n\t}\r\n]\r\n");
+	}
+}
+
+TEST_CASE("Writer Serialized Size", "[writer]")
+{
+	const auto write_clip = [](Writer& writer)
+	{
+		writer.insert("name", "clip");
+		writer.insert("sample_rate", 30U);
+		writer.insert("duration", 1.25);
+		writer.insert("precision", 0.1);
+		writer.insert("tracks", [](ArrayWriter& array_writer)
+		{
+			array_writer.push([](ObjectWriter& object_writer)
+			{
+				object_writer["values"] = [](ArrayWriter& array_writer1)
+				{
+					array_writer1.push(std::nan(""));
+					array_writer1.push(-123);
+				};
+			});
+		});
+	};
+
+	{
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		write_clip(writer);
+
+		const size_t size = get_serialized_size(write_clip);
+		CHECK(size == str_writer.str().size());
+
+		std::string buffer(size, '\0');
+		BufferStreamWriter buffer_writer(&buffer[0], buffer.size());
+		Writer buffered_writer(buffer_writer);
+		write_clip(buffered_writer);
+		CHECK(buffer_writer.get_size() == size);
+		CHECK(!buffer_writer.is_truncated());
+		CHECK(buffer == str_writer.str());
+	}
+
+	const FloatFormat float_formats[] = { FloatFormat::Hexadecimal, FloatFormat::ShortestDecimal };
+	for (const FloatFormat float_format : float_formats)
+	{
+		StringStreamWriter str_writer;
+		Writer writer(str_writer, float_format);
+		write_clip(writer);
+
+		CHECK(get_serialized_size(write_clip, float_format) == str_writer.str().size());
+		CHECK(get_serialized_size(write_clip) != str_writer.str().size());
+	}
+
+	{
+		CountingStreamWriter counting_writer;
+		Writer writer(counting_writer);
+		writer.insert("key", true);
+		CHECK(counting_writer.get_size() == std::strlen("key = true\r\n"));
+		counting_writer.reset();
+		CHECK(counting_writer.get_size() == 0);
+	}
+
+	{
+		char buffer[4];
+		BufferStreamWriter buffer_writer(buffer, sizeof(buffer));
+		Writer writer(buffer_writer);
+		CHECK_THROWS(writer.insert("key", true));
+	}
+}
+
+TEST_CASE("Writer Key Lengths", "[writer]")
+{
+	static constexpr KeyView k_literal_key("literal_key");
+	static_assert(k_literal_key.size() == 11, "Literal key length must be known at compile time");
+	static_assert(!k_literal_key.requires_quotes(), "Literal key must not require quotes");
+	static_assert(KeyView("some key").requires_quotes(), "Key with whitespace must require quotes");
+
+	{
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer.insert(k_literal_key, "literal value");
+		writer[k_literal_key] = 1U;
+		CHECK(str_writer.str() == "literal_key = \"literal value\"\r\nliteral_key = 1\r\n");
+	}
+
+	{
+		// Arrays of const char larger than their string stop at the first NULL terminator, like a Key
+		static const char k_padded_key[16] = "abc";
+		static constexpr Key k_shared_key("shared key");
+
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer[k_padded_key] = 1U;
+		writer[k_shared_key] = 2U;
+		CHECK(str_writer.str() == "abc = 1\r\n\"shared key\" = 2\r\n");
+
+		const std::string output = str_writer.str();
+		Parser parser(output.c_str(), output.size());
+		uint32_t value;
+		CHECK(parser.read(k_padded_key, value));
+		CHECK(value == 1);
+		CHECK(parser.read(k_shared_key, value));
+		CHECK(value == 2);
+		CHECK(parser.is_valid());
+	}
+
+	{
+		// Mutable buffers are not assumed to be filled to capacity
+		char key_buffer[64];
+		char value_buffer[64];
+		std::snprintf(key_buffer, sizeof(key_buffer), "track_%u", 3U);
+		std::snprintf(value_buffer, sizeof(value_buffer), "value_%u", 4U);
+
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer.insert(key_buffer, value_buffer);
+		writer[key_buffer] = value_buffer;
+		writer.insert("key", [&](ArrayWriter& array_writer)
+		{
+			array_writer.push(value_buffer);
+			array_writer.push("literal");
+		});
+		CHECK(str_writer.str() == "track_3 = \"value_4\"\r\ntrack_3 = \"value_4\"\r\nkey = [ \"value_4\", \"literal\" ]\r\n");
+	}
+
+	{
+		const char* key = "pointer_key";
+		const char* value = "pointer value";
+		const std::string long_key = "some_key_with_a_suffix";
+
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer.insert(key, value);
+		writer.insert(StringView(long_key.c_str(), 8), StringView(value, 7));
+		writer[StringView(long_key.c_str(), 4)] = true;
+		CHECK(str_writer.str() == "pointer_key = \"pointer value\"\r\nsome_key = \"pointer\"\r\nsome = true\r\n");
+	}
+}
+
+TEST_CASE("Writer Hexadecimal Float Writing", "[writer]")
+{
+	{
+		StringStreamWriter str_writer;
+		Writer writer(str_writer, FloatFormat::Hexadecimal);
+		writer.insert("key0", 12.5);
+		writer["key1"] = -0.25F;
+		writer.insert("key2", [](ArrayWriter& array_writer)
+		{
+			array_writer.push(0.0);
+			array_writer.push(1.0);
+			array_writer.push(std::nan(""));
+		});
+		writer.insert("key3", [](ObjectWriter& object_writer)
+		{
+			object_writer.insert("key4", std::numeric_limits<double>::denorm_min());
+		});
+		CHECK(str_writer.str() == "key0 = 0x1.9p+3\r\nkey1 = -0x1p-2\r\nkey2 = [ 0x0p+0, 0x1p+0, \"nan\" ]\r\nkey3 = {\r\n\tkey4 = 0x0.0000000000001p-1022\r\n}\r\n");
+	}
+
+	{
+		StringStreamWriter str_writer;
+		Writer writer(str_writer, FloatFormat::Hexadecimal);
+		writer.insert("key", -std::numeric_limits<double>::max());
+		CHECK(str_writer.str() == "key = -0x1.fffffffffffffp+1023\r\n");
+	}
+}
+
+TEST_CASE("Writer Blob Writing", "[writer]")
+{
+	{
+		const float values[] = { 10.0F, 5.0F };
+		const int16_t integers[] = { 1, -2, 3 };
+		const char* text = "hello world!!";
+
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer.insert_blob("floats", values, 2);
+		writer.insert_blob("integers", integers, 3);
+		writer.insert_blob("text", text, std::strlen(text));
+		writer.insert_blob("empty", text, 0);
+		CHECK(str_writer.str() == "floats = \"AAAgQQAAoEA=\"\r\nintegers = \"AQD+/wMA\"\r\ntext = \"aGVsbG8gd29ybGQhIQ==\"\r\nempty = \"\"\r\n");
+	}
+
+	{
+		// Large enough to span multiple encoding chunks
+		std::string data(5000, '\0');
+		for (size_t i = 0; i < data.size(); ++i)
+			data[i] = static_cast<char>(i * 7);
+
+		StringStreamWriter str_writer;
+		Writer writer(str_writer);
+		writer.insert_blob("key", data.c_str(), data.size());
+
+		std::string expected(sjson_impl::get_base64_encoded_size(data.size()), '\0');
+		sjson_impl::encode_base64(reinterpret_cast<const uint8_t*>(data.c_str()), data.size(), &expected[0]);
+		CHECK(str_writer.str() == "key = \"" + expected + "\"\r\n");
+	}
+}